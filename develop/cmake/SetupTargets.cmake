@@ -36,4 +36,6 @@ target_link_libraries(${PROJECT_NAME}.setup_targets INTERFACE
         meta.hpp::disable_rtti>)
 
 target_compile_definitions(${PROJECT_NAME}.setup_targets INTERFACE
-    $<$<BOOL:${META_HPP_DEVELOP_WITH_SANITIZERS}>:META_HPP_SANITIZERS>)
+    $<$<BOOL:${META_HPP_DEVELOP_WITH_SANITIZERS}>:META_HPP_SANITIZERS>
+    $<$<BOOL:${META_HPP_DEVELOP_WITH_PROFILER}>:META_HPP_WITH_PROFILER>
+    $<$<BOOL:${META_HPP_DEVELOP_WITH_ASYNC}>:META_HPP_WITH_ASYNC>)
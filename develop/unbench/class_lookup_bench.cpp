@@ -0,0 +1,185 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    namespace meta = meta_hpp;
+
+    constexpr std::size_t method_count{160};
+
+    struct clazz {
+        template < std::size_t I >
+        std::size_t method() const {
+            return I;
+        }
+    };
+
+    struct base_clazz_1 : virtual clazz {
+        META_HPP_ENABLE_BASE_INFO(clazz)
+    };
+
+    struct base_clazz_2 : virtual clazz {
+        META_HPP_ENABLE_BASE_INFO(clazz)
+    };
+
+    struct derived_clazz : base_clazz_1, base_clazz_2 {
+        META_HPP_ENABLE_BASE_INFO(base_clazz_1, base_clazz_2)
+    };
+
+    std::string make_method_name(std::size_t index) {
+        return "method_" + std::to_string(index);
+    }
+
+    meta::class_type bind_clazz() {
+        []<std::size_t... Is>(std::index_sequence<Is...>) {
+            auto bind = meta::class_<clazz>();
+            (bind.method_(make_method_name(Is), &clazz::method<Is>), ...);
+        }(std::make_index_sequence<method_count>());
+        return meta::resolve_type<clazz>();
+    }
+
+    meta::class_type bind_derived_clazz() {
+        bind_clazz();
+        return meta::resolve_type<derived_clazz>();
+    }
+
+    meta::method scan_method(const meta::class_type& type, std::string_view name) {
+        for ( const meta::method& method : type.get_methods() ) {
+            if ( method.get_name() == name ) {
+                return method;
+            }
+        }
+        return meta::method{};
+    }
+
+    meta::method scan_method_recursively(const meta::class_type& type, std::string_view name) {
+        if ( const meta::method& method = scan_method(type, name) ) {
+            return method;
+        }
+        const meta::class_list& bases = type.get_base_classes();
+        for ( auto iter{bases.rbegin()}, end{bases.rend()}; iter != end; ++iter ) {
+            if ( const meta::method& method = scan_method_recursively(*iter, name) ) {
+                return method;
+            }
+        }
+        return meta::method{};
+    }
+}
+
+namespace
+{
+    [[maybe_unused]]
+    void scan_method_first(benchmark::State &state) {
+        const meta::class_type clazz_type = bind_clazz();
+        const std::string name = make_method_name(0);
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(scan_method(clazz_type, name));
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_get_method_first(benchmark::State &state) {
+        const meta::class_type clazz_type = bind_clazz();
+        const std::string name = make_method_name(0);
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(clazz_type.get_method(name));
+        }
+    }
+
+    [[maybe_unused]]
+    void scan_method_last(benchmark::State &state) {
+        const meta::class_type clazz_type = bind_clazz();
+        const std::string name = make_method_name(method_count - 1);
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(scan_method(clazz_type, name));
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_get_method_last(benchmark::State &state) {
+        const meta::class_type clazz_type = bind_clazz();
+        const std::string name = make_method_name(method_count - 1);
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(clazz_type.get_method(name));
+        }
+    }
+
+    [[maybe_unused]]
+    void scan_method_missing(benchmark::State &state) {
+        const meta::class_type clazz_type = bind_clazz();
+        const std::string name = make_method_name(method_count);
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(scan_method(clazz_type, name));
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_get_method_missing(benchmark::State &state) {
+        const meta::class_type clazz_type = bind_clazz();
+        const std::string name = make_method_name(method_count);
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(clazz_type.get_method(name));
+        }
+    }
+}
+
+namespace
+{
+    [[maybe_unused]]
+    void scan_method_recursively_diamond(benchmark::State &state) {
+        const meta::class_type derived_clazz_type = bind_derived_clazz();
+        const std::string name = make_method_name(method_count - 1);
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(scan_method_recursively(derived_clazz_type, name));
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_get_method_recursively_diamond(benchmark::State &state) {
+        const meta::class_type derived_clazz_type = bind_derived_clazz();
+        const std::string name = make_method_name(method_count - 1);
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(derived_clazz_type.get_method(name, true));
+        }
+    }
+
+    [[maybe_unused]]
+    void scan_method_recursively_diamond_missing(benchmark::State &state) {
+        const meta::class_type derived_clazz_type = bind_derived_clazz();
+        const std::string name = make_method_name(method_count);
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(scan_method_recursively(derived_clazz_type, name));
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_get_method_recursively_diamond_missing(benchmark::State &state) {
+        const meta::class_type derived_clazz_type = bind_derived_clazz();
+        const std::string name = make_method_name(method_count);
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(derived_clazz_type.get_method(name, true));
+        }
+    }
+}
+
+BENCHMARK(scan_method_first);
+BENCHMARK(meta_get_method_first);
+
+BENCHMARK(scan_method_last);
+BENCHMARK(meta_get_method_last);
+
+BENCHMARK(scan_method_missing);
+BENCHMARK(meta_get_method_missing);
+
+BENCHMARK(scan_method_recursively_diamond);
+BENCHMARK(meta_get_method_recursively_diamond);
+
+BENCHMARK(scan_method_recursively_diamond_missing);
+BENCHMARK(meta_get_method_recursively_diamond_missing);
@@ -239,3 +239,258 @@ BENCHMARK(dynamic_cast_3b);
 BENCHMARK(meta_dynamic_cast_3b);
 BENCHMARK(dynamic_cast_3c);
 BENCHMARK(meta_dynamic_cast_3c);
+
+namespace
+{
+    struct A4 {
+        META_HPP_ENABLE_POLY_INFO()
+    };
+
+    struct B4 : A4 {
+        META_HPP_ENABLE_POLY_INFO(A4)
+    };
+
+    struct C4 : B4 {
+        META_HPP_ENABLE_POLY_INFO(B4)
+    };
+
+    struct D4 : C4 {
+        META_HPP_ENABLE_POLY_INFO(C4)
+    };
+
+    struct E4 : D4 {
+        META_HPP_ENABLE_POLY_INFO(D4)
+    };
+
+    struct F4 : E4 {
+        META_HPP_ENABLE_POLY_INFO(E4)
+    };
+
+    struct G4 : F4 {
+        META_HPP_ENABLE_POLY_INFO(F4)
+    };
+
+    struct H4 : G4 {
+        META_HPP_ENABLE_POLY_INFO(G4)
+    };
+
+    // A4 < B4 < C4 < D4 < E4 < F4 < G4 < H4
+
+    [[maybe_unused]]
+    void dynamic_cast_4a(benchmark::State &state) {
+        H4 h;
+        for ( auto _ : state ) {
+            A4* a = &h;
+            H4* hh = dyn_cast<H4>(a);
+            benchmark::DoNotOptimize(hh);
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_dynamic_cast_4a(benchmark::State &state) {
+        H4 h;
+        for ( auto _ : state ) {
+            A4* a = &h;
+            H4* hh = meta::ucast<H4*>(a);
+            benchmark::DoNotOptimize(hh);
+        }
+    }
+
+    [[maybe_unused]]
+    void dynamic_cast_4b(benchmark::State &state) {
+        H4 h;
+        for ( auto _ : state ) {
+            A4* a = &h;
+            D4* d = dyn_cast<D4>(a);
+            benchmark::DoNotOptimize(d);
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_dynamic_cast_4b(benchmark::State &state) {
+        H4 h;
+        for ( auto _ : state ) {
+            A4* a = &h;
+            D4* d = meta::ucast<D4*>(a);
+            benchmark::DoNotOptimize(d);
+        }
+    }
+
+    [[maybe_unused]]
+    void dynamic_cast_4c(benchmark::State &state) {
+        G4 g;
+        for ( auto _ : state ) {
+            A4* a = &g;
+            H4* h = dyn_cast<H4>(a);
+            benchmark::DoNotOptimize(h);
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_dynamic_cast_4c(benchmark::State &state) {
+        G4 g;
+        for ( auto _ : state ) {
+            A4* a = &g;
+            H4* h = meta::ucast<H4*>(a);
+            benchmark::DoNotOptimize(h);
+        }
+    }
+}
+
+BENCHMARK(dynamic_cast_4a);
+BENCHMARK(meta_dynamic_cast_4a);
+BENCHMARK(dynamic_cast_4b);
+BENCHMARK(meta_dynamic_cast_4b);
+BENCHMARK(dynamic_cast_4c);
+BENCHMARK(meta_dynamic_cast_4c);
+
+namespace
+{
+    struct A5 {
+        META_HPP_ENABLE_POLY_INFO()
+    };
+
+    struct B5 {
+        META_HPP_ENABLE_POLY_INFO()
+    };
+
+    struct C5 {
+        META_HPP_ENABLE_POLY_INFO()
+    };
+
+    struct D5 {
+        META_HPP_ENABLE_POLY_INFO()
+    };
+
+    struct E5 {
+        META_HPP_ENABLE_POLY_INFO()
+    };
+
+    struct F5 {
+        META_HPP_ENABLE_POLY_INFO()
+    };
+
+    struct G5 : A5, B5, C5, D5, E5, F5 {
+        META_HPP_ENABLE_POLY_INFO(A5, B5, C5, D5, E5, F5)
+    };
+
+    // A5 B5 C5 D5 E5 F5
+    //         < G5
+
+    [[maybe_unused]]
+    void dynamic_cast_5a(benchmark::State &state) {
+        G5 g;
+        for ( auto _ : state ) {
+            F5* f = &g;
+            G5* gg = dyn_cast<G5>(f);
+            benchmark::DoNotOptimize(gg);
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_dynamic_cast_5a(benchmark::State &state) {
+        G5 g;
+        for ( auto _ : state ) {
+            F5* f = &g;
+            G5* gg = meta::ucast<G5*>(f);
+            benchmark::DoNotOptimize(gg);
+        }
+    }
+
+    [[maybe_unused]]
+    void dynamic_cast_5b(benchmark::State &state) {
+        G5 g;
+        for ( auto _ : state ) {
+            A5* a = &g;
+            F5* f = dyn_cast<F5>(a);
+            benchmark::DoNotOptimize(f);
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_dynamic_cast_5b(benchmark::State &state) {
+        G5 g;
+        for ( auto _ : state ) {
+            A5* a = &g;
+            F5* f = meta::ucast<F5*>(a);
+            benchmark::DoNotOptimize(f);
+        }
+    }
+}
+
+BENCHMARK(dynamic_cast_5a);
+BENCHMARK(meta_dynamic_cast_5a);
+BENCHMARK(dynamic_cast_5b);
+BENCHMARK(meta_dynamic_cast_5b);
+
+namespace
+{
+    struct A6 {
+        META_HPP_ENABLE_POLY_INFO()
+    };
+
+    struct B6 : A6 {
+        META_HPP_ENABLE_POLY_INFO(A6)
+    };
+
+    struct C6 : B6 {
+        META_HPP_ENABLE_POLY_INFO(B6)
+    };
+
+    struct D6 : B6 {
+        META_HPP_ENABLE_POLY_INFO(B6)
+    };
+
+    struct E6 : C6, D6 {
+        META_HPP_ENABLE_POLY_INFO(C6, D6)
+    };
+
+    // A6 < B6 < C6
+    //              < E6
+    // A6 < B6 < D6
+
+    [[maybe_unused]]
+    void dynamic_cast_6a(benchmark::State &state) {
+        E6 e;
+        for ( auto _ : state ) {
+            A6* a = static_cast<D6*>(&e);
+            B6* b = dyn_cast<B6>(a);
+            benchmark::DoNotOptimize(b);
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_dynamic_cast_6a(benchmark::State &state) {
+        E6 e;
+        for ( auto _ : state ) {
+            A6* a = static_cast<D6*>(&e);
+            B6* b = meta::ucast<B6*>(a);
+            benchmark::DoNotOptimize(b);
+        }
+    }
+
+    [[maybe_unused]]
+    void dynamic_cast_6b(benchmark::State &state) {
+        E6 e;
+        for ( auto _ : state ) {
+            A6* a = static_cast<D6*>(&e);
+            C6* c = dyn_cast<C6>(a);
+            benchmark::DoNotOptimize(c);
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_dynamic_cast_6b(benchmark::State &state) {
+        E6 e;
+        for ( auto _ : state ) {
+            A6* a = static_cast<D6*>(&e);
+            C6* c = meta::ucast<C6*>(a);
+            benchmark::DoNotOptimize(c);
+        }
+    }
+}
+
+BENCHMARK(dynamic_cast_6a);
+BENCHMARK(meta_dynamic_cast_6a);
+BENCHMARK(dynamic_cast_6b);
+BENCHMARK(meta_dynamic_cast_6b);
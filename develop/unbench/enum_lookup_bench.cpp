@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    namespace meta = meta_hpp;
+
+    constexpr std::size_t evalue_count{64};
+
+    enum class dense_enum : int {};
+    enum class sparse_enum : int {};
+
+    std::string make_evalue_name(std::size_t index) {
+        return "evalue_" + std::to_string(index);
+    }
+
+    template < typename Enum >
+    Enum make_evalue(std::size_t index) {
+        if constexpr ( std::is_same_v<Enum, sparse_enum> ) {
+            return static_cast<Enum>(index * index * 7);
+        } else {
+            return static_cast<Enum>(index);
+        }
+    }
+
+    template < typename Enum >
+    meta::enum_type bind_enum() {
+        auto bind = meta::enum_<Enum>();
+        for ( std::size_t i{}; i < evalue_count; ++i ) {
+            bind.evalue_(make_evalue_name(i), make_evalue<Enum>(i));
+        }
+        return meta::resolve_type<Enum>();
+    }
+
+    template < typename Enum >
+    std::string_view scan_value_to_name(const meta::enum_type& type, Enum value) {
+        for ( const meta::evalue& evalue : type.get_evalues() ) {
+            if ( evalue.get_value().as<Enum>() == value ) {
+                return evalue.get_name();
+            }
+        }
+        return std::string_view{};
+    }
+
+    template < typename Enum >
+    Enum scan_name_to_value(const meta::enum_type& type, std::string_view name) {
+        for ( const meta::evalue& evalue : type.get_evalues() ) {
+            if ( evalue.get_name() == name ) {
+                return evalue.get_value().as<Enum>();
+            }
+        }
+        return Enum{};
+    }
+}
+
+namespace
+{
+    template < typename Enum >
+    void scan_value_to_name(benchmark::State &state) {
+        const meta::enum_type enum_type = bind_enum<Enum>();
+        const Enum value = make_evalue<Enum>(evalue_count - 1);
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(scan_value_to_name(enum_type, value));
+        }
+    }
+
+    template < typename Enum >
+    void meta_value_to_name(benchmark::State &state) {
+        const meta::enum_type enum_type = bind_enum<Enum>();
+        const Enum value = make_evalue<Enum>(evalue_count - 1);
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(enum_type.value_to_name(value));
+        }
+    }
+
+    template < typename Enum >
+    void meta_uvalue_to_name(benchmark::State &state) {
+        const meta::enum_type enum_type = bind_enum<Enum>();
+        const meta::uvalue value{make_evalue<Enum>(evalue_count - 1)};
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(enum_type.value_to_name(value));
+        }
+    }
+
+    template < typename Enum >
+    void scan_name_to_value(benchmark::State &state) {
+        const meta::enum_type enum_type = bind_enum<Enum>();
+        const std::string name = make_evalue_name(evalue_count - 1);
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(scan_name_to_value<Enum>(enum_type, name));
+        }
+    }
+
+    template < typename Enum >
+    void meta_name_to_value(benchmark::State &state) {
+        const meta::enum_type enum_type = bind_enum<Enum>();
+        const std::string name = make_evalue_name(evalue_count - 1);
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(enum_type.name_to_value<Enum>(name));
+        }
+    }
+}
+
+BENCHMARK(scan_value_to_name<dense_enum>);
+BENCHMARK(meta_value_to_name<dense_enum>);
+BENCHMARK(meta_uvalue_to_name<dense_enum>);
+
+BENCHMARK(scan_value_to_name<sparse_enum>);
+BENCHMARK(meta_value_to_name<sparse_enum>);
+BENCHMARK(meta_uvalue_to_name<sparse_enum>);
+
+BENCHMARK(scan_name_to_value<dense_enum>);
+BENCHMARK(meta_name_to_value<dense_enum>);
@@ -153,17 +153,285 @@ namespace
     }
 }
 
+//
+// meta_try
+//
+
+namespace
+{
+    [[maybe_unused]]
+    void meta_try_invoke_function_0(benchmark::State &state) {
+        meta::function f = meta_bench_scope.get_function("invoke_function_0");
+        META_HPP_ASSERT(f.is_valid());
+
+        for ( auto _ : state ) {
+            std::ignore = f.try_invoke();
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_try_invoke_function_1(benchmark::State &state) {
+        meta::function f = meta_bench_scope.get_function("invoke_function_1");
+        META_HPP_ASSERT(f.is_valid());
+
+        for ( auto _ : state ) {
+            std::ignore = f.try_invoke(static_angle);
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_try_invoke_function_2(benchmark::State &state) {
+        meta::function f = meta_bench_scope.get_function("invoke_function_2");
+        META_HPP_ASSERT(f.is_valid());
+
+        for ( auto _ : state ) {
+            std::ignore = f.try_invoke(static_angle, vmath::unit3_x<float>);
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_try_invoke_function_3(benchmark::State &state) {
+        meta::function f = meta_bench_scope.get_function("invoke_function_3");
+        META_HPP_ASSERT(f.is_valid());
+
+        for ( auto _ : state ) {
+            std::ignore = f.try_invoke(static_angle, vmath::unit3_x<float>, 2.f);
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_try_invoke_function_4(benchmark::State &state) {
+        meta::function f = meta_bench_scope.get_function("invoke_function_4");
+        META_HPP_ASSERT(f.is_valid());
+
+        for ( auto _ : state ) {
+            std::ignore = f.try_invoke(static_angle, vmath::unit3_x<float>, 2.f, vmath::midentity3<float>);
+        }
+    }
+}
+
+//
+// meta_plan
+//
+
+namespace
+{
+    [[maybe_unused]]
+    void meta_plan_invoke_function_0(benchmark::State &state) {
+        meta::function_plan<> f{meta_bench_scope.get_function("invoke_function_0")};
+        META_HPP_ASSERT(f.is_valid());
+
+        for ( auto _ : state ) {
+            f();
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_plan_invoke_function_1(benchmark::State &state) {
+        meta::function_plan<float&> f{meta_bench_scope.get_function("invoke_function_1")};
+        META_HPP_ASSERT(f.is_valid());
+
+        for ( auto _ : state ) {
+            f(static_angle);
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_plan_invoke_function_2(benchmark::State &state) {
+        meta::function_plan<float&, const vmath::fvec3&> f{meta_bench_scope.get_function("invoke_function_2")};
+        META_HPP_ASSERT(f.is_valid());
+
+        for ( auto _ : state ) {
+            f(static_angle, vmath::unit3_x<float>);
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_plan_invoke_function_3(benchmark::State &state) {
+        meta::function_plan<float&, const vmath::fvec3&, float> f{meta_bench_scope.get_function("invoke_function_3")};
+        META_HPP_ASSERT(f.is_valid());
+
+        for ( auto _ : state ) {
+            f(static_angle, vmath::unit3_x<float>, 2.f);
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_plan_invoke_function_4(benchmark::State &state) {
+        meta::function_plan<float&, const vmath::fvec3&, float, const vmath::fmat3&> f{
+            meta_bench_scope.get_function("invoke_function_4")};
+        META_HPP_ASSERT(f.is_valid());
+
+        for ( auto _ : state ) {
+            f(static_angle, vmath::unit3_x<float>, 2.f, vmath::midentity3<float>);
+        }
+    }
+}
+
+//
+// meta_typed
+//
+
+namespace
+{
+    [[maybe_unused]]
+    void meta_typed_invoke_function_0(benchmark::State &state) {
+        const auto f = meta_bench_scope.get_function("invoke_function_0").as_typed<void()>();
+        META_HPP_ASSERT(f.is_valid());
+
+        for ( auto _ : state ) {
+            f();
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_typed_invoke_function_1(benchmark::State &state) {
+        const auto f = meta_bench_scope.get_function("invoke_function_1").as_typed<void(float)>();
+        META_HPP_ASSERT(f.is_valid());
+
+        for ( auto _ : state ) {
+            f(static_angle);
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_typed_invoke_function_2(benchmark::State &state) {
+        const auto f = meta_bench_scope.get_function("invoke_function_2").as_typed<void(float, const vmath::fvec3&)>();
+        META_HPP_ASSERT(f.is_valid());
+
+        for ( auto _ : state ) {
+            f(static_angle, vmath::unit3_x<float>);
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_typed_invoke_function_3(benchmark::State &state) {
+        const auto f = meta_bench_scope.get_function("invoke_function_3").as_typed<void(float, const vmath::fvec3&, float)>();
+        META_HPP_ASSERT(f.is_valid());
+
+        for ( auto _ : state ) {
+            f(static_angle, vmath::unit3_x<float>, 2.f);
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_typed_invoke_function_4(benchmark::State &state) {
+        const auto f = meta_bench_scope.get_function("invoke_function_4")
+                           .as_typed<void(float, const vmath::fvec3&, float, const vmath::fmat3&)>();
+        META_HPP_ASSERT(f.is_valid());
+
+        for ( auto _ : state ) {
+            f(static_angle, vmath::unit3_x<float>, 2.f, vmath::midentity3<float>);
+        }
+    }
+}
+
+//
+// meta_variadic
+//
+
+namespace
+{
+    [[maybe_unused]]
+    void meta_variadic_invoke_function_4(benchmark::State &state) {
+        meta::function f = meta_bench_scope.get_function("invoke_function_4");
+        META_HPP_ASSERT(f.is_valid());
+
+        std::vector<meta::uvalue> args;
+        args.emplace_back(static_angle);
+        args.emplace_back(vmath::unit3_x<float>);
+        args.emplace_back(2.f);
+        args.emplace_back(vmath::midentity3<float>);
+
+        for ( auto _ : state ) {
+            f.invoke_variadic(args.begin(), args.end());
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_span_invoke_function_4(benchmark::State &state) {
+        meta::function f = meta_bench_scope.get_function("invoke_function_4");
+        META_HPP_ASSERT(f.is_valid());
+
+        std::vector<meta::uvalue> args;
+        args.emplace_back(static_angle);
+        args.emplace_back(vmath::unit3_x<float>);
+        args.emplace_back(2.f);
+        args.emplace_back(vmath::midentity3<float>);
+
+        for ( auto _ : state ) {
+            f.invoke_variadic(std::span<const meta::uvalue>{args});
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_span_copy_invoke_function_4(benchmark::State &state) {
+        meta::function f = meta_bench_scope.get_function("invoke_function_4");
+        META_HPP_ASSERT(f.is_valid());
+
+        const float angle{static_angle};
+        const vmath::fvec3 axis{vmath::unit3_x<float>};
+        const float scale{2.f};
+        const vmath::fmat3 transform{vmath::midentity3<float>};
+
+        for ( auto _ : state ) {
+            std::array<meta::uvalue, 4> args{angle, axis, scale, transform};
+            f.invoke_variadic(std::span<const meta::uvalue>{args});
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_span_ref_invoke_function_4(benchmark::State &state) {
+        meta::function f = meta_bench_scope.get_function("invoke_function_4");
+        META_HPP_ASSERT(f.is_valid());
+
+        const float angle{static_angle};
+        const vmath::fvec3 axis{vmath::unit3_x<float>};
+        const float scale{2.f};
+        const vmath::fmat3 transform{vmath::midentity3<float>};
+
+        for ( auto _ : state ) {
+            const std::array<meta::uvalue_ref, 4> args{
+                meta::uvalue_ref{angle},
+                meta::uvalue_ref{axis},
+                meta::uvalue_ref{scale},
+                meta::uvalue_ref{transform},
+            };
+            f.invoke_variadic(std::span<const meta::uvalue_ref>{args});
+        }
+    }
+}
+
 BENCHMARK(invoke_function_0)->Teardown(static_function_reset);
 BENCHMARK(meta_invoke_function_0)->Teardown(static_function_reset);
+BENCHMARK(meta_try_invoke_function_0)->Teardown(static_function_reset);
+BENCHMARK(meta_plan_invoke_function_0)->Teardown(static_function_reset);
+BENCHMARK(meta_typed_invoke_function_0)->Teardown(static_function_reset);
 
 BENCHMARK(invoke_function_1)->Teardown(static_function_reset);
 BENCHMARK(meta_invoke_function_1)->Teardown(static_function_reset);
+BENCHMARK(meta_try_invoke_function_1)->Teardown(static_function_reset);
+BENCHMARK(meta_plan_invoke_function_1)->Teardown(static_function_reset);
+BENCHMARK(meta_typed_invoke_function_1)->Teardown(static_function_reset);
 
 BENCHMARK(invoke_function_2)->Teardown(static_function_reset);
 BENCHMARK(meta_invoke_function_2)->Teardown(static_function_reset);
+BENCHMARK(meta_try_invoke_function_2)->Teardown(static_function_reset);
+BENCHMARK(meta_plan_invoke_function_2)->Teardown(static_function_reset);
+BENCHMARK(meta_typed_invoke_function_2)->Teardown(static_function_reset);
 
 BENCHMARK(invoke_function_3)->Teardown(static_function_reset);
 BENCHMARK(meta_invoke_function_3)->Teardown(static_function_reset);
+BENCHMARK(meta_try_invoke_function_3)->Teardown(static_function_reset);
+BENCHMARK(meta_plan_invoke_function_3)->Teardown(static_function_reset);
+BENCHMARK(meta_typed_invoke_function_3)->Teardown(static_function_reset);
 
 BENCHMARK(invoke_function_4)->Teardown(static_function_reset);
 BENCHMARK(meta_invoke_function_4)->Teardown(static_function_reset);
+BENCHMARK(meta_try_invoke_function_4)->Teardown(static_function_reset);
+BENCHMARK(meta_plan_invoke_function_4)->Teardown(static_function_reset);
+BENCHMARK(meta_typed_invoke_function_4)->Teardown(static_function_reset);
+BENCHMARK(meta_variadic_invoke_function_4)->Teardown(static_function_reset);
+BENCHMARK(meta_span_invoke_function_4)->Teardown(static_function_reset);
+BENCHMARK(meta_span_copy_invoke_function_4)->Teardown(static_function_reset);
+BENCHMARK(meta_span_ref_invoke_function_4)->Teardown(static_function_reset);
\ No newline at end of file
@@ -0,0 +1,351 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <vmath.hpp/vmath_all.hpp>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    namespace meta = meta_hpp;
+    namespace vmath = vmath_hpp;
+
+    struct rotator {
+        float angle{};
+        volatile float acc{};
+        std::string name{"rotator, it's a long enough name"};
+
+        void rotate_0() {
+            acc = acc + vmath::determinant(vmath::rotate(angle, vmath::unit3_x<float>));
+            angle = angle + 0.00001f;
+        }
+
+        void rotate_2(const vmath::fvec3& axis, float mul) {
+            acc = acc + vmath::determinant(vmath::rotate(angle, axis)) * mul;
+            angle = angle + 0.00001f;
+        }
+
+        [[nodiscard]] float determinant_1(const vmath::fmat3& mat) const {
+            return vmath::determinant(vmath::rotate(angle, vmath::unit3_x<float>) * mat);
+        }
+
+        [[nodiscard]] const std::string& get_name() const {
+            return name;
+        }
+    };
+
+    rotator static_rotator{};
+
+    [[maybe_unused]]
+    void static_rotator_reset(const benchmark::State&) {
+        static_rotator = rotator{};
+    }
+
+    const bool meta_bench_registered = []() {
+        meta::class_<rotator>()
+            .member_("angle", &rotator::angle)
+            .method_("rotate_0", &rotator::rotate_0)
+            .method_("rotate_2", &rotator::rotate_2)
+            .method_("determinant_1", &rotator::determinant_1)
+            .method_("get_name", &rotator::get_name);
+        return true;
+    }();
+}
+
+//
+// native
+//
+
+namespace
+{
+    [[maybe_unused]]
+    void invoke_method_0(benchmark::State &state) {
+        for ( auto _ : state ) {
+            static_rotator.rotate_0();
+        }
+    }
+
+    [[maybe_unused]]
+    void invoke_method_1(benchmark::State &state) {
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(static_rotator.determinant_1(vmath::midentity3<float>));
+        }
+    }
+
+    [[maybe_unused]]
+    void invoke_method_2(benchmark::State &state) {
+        for ( auto _ : state ) {
+            static_rotator.rotate_2(vmath::unit3_x<float>, 2.f);
+        }
+    }
+}
+
+//
+// meta
+//
+
+namespace
+{
+    [[maybe_unused]]
+    void meta_invoke_method_0(benchmark::State &state) {
+        meta::method m = meta::resolve_type<rotator>().get_method("rotate_0");
+        META_HPP_ASSERT(m.is_valid());
+
+        for ( auto _ : state ) {
+            m(static_rotator);
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_invoke_method_1(benchmark::State &state) {
+        meta::method m = meta::resolve_type<rotator>().get_method("determinant_1");
+        META_HPP_ASSERT(m.is_valid());
+
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(m(static_rotator, vmath::midentity3<float>));
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_invoke_method_2(benchmark::State &state) {
+        meta::method m = meta::resolve_type<rotator>().get_method("rotate_2");
+        META_HPP_ASSERT(m.is_valid());
+
+        for ( auto _ : state ) {
+            m(static_rotator, vmath::unit3_x<float>, 2.f);
+        }
+    }
+}
+
+//
+// meta_typed
+//
+
+namespace
+{
+    [[maybe_unused]]
+    void meta_typed_invoke_method_0(benchmark::State &state) {
+        const auto m = meta::resolve_type<rotator>().get_method("rotate_0").as_typed<void(rotator&)>();
+        META_HPP_ASSERT(m.is_valid());
+
+        for ( auto _ : state ) {
+            m(static_rotator);
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_typed_invoke_method_1(benchmark::State &state) {
+        const auto m = meta::resolve_type<rotator>() //
+                           .get_method("determinant_1")
+                           .as_typed<float(const rotator&, const vmath::fmat3&)>();
+        META_HPP_ASSERT(m.is_valid());
+
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(m(static_rotator, vmath::midentity3<float>));
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_typed_invoke_method_2(benchmark::State &state) {
+        const auto m = meta::resolve_type<rotator>() //
+                           .get_method("rotate_2")
+                           .as_typed<void(rotator&, const vmath::fvec3&, float)>();
+        META_HPP_ASSERT(m.is_valid());
+
+        for ( auto _ : state ) {
+            m(static_rotator, vmath::unit3_x<float>, 2.f);
+        }
+    }
+}
+
+//
+// getter
+//
+
+namespace
+{
+    [[maybe_unused]]
+    void invoke_getter(benchmark::State &state) {
+        std::string result;
+        for ( auto _ : state ) {
+            result = static_rotator.get_name();
+            benchmark::DoNotOptimize(result);
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_invoke_getter(benchmark::State &state) {
+        meta::method m = meta::resolve_type<rotator>().get_method("get_name");
+        META_HPP_ASSERT(m.is_valid());
+
+        meta::uvalue result;
+        for ( auto _ : state ) {
+            result = m(static_rotator);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_invoke_into_getter(benchmark::State &state) {
+        meta::method m = meta::resolve_type<rotator>().get_method("get_name");
+        META_HPP_ASSERT(m.is_valid());
+
+        meta::uvalue result;
+        for ( auto _ : state ) {
+            m.invoke_into(result, static_rotator);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+}
+
+//
+// batch
+//
+
+namespace
+{
+    constexpr std::size_t batch_size{1024};
+
+    [[maybe_unused]]
+    void invoke_method_batch(benchmark::State &state) {
+        std::vector<rotator> rotators(batch_size);
+
+        for ( auto _ : state ) {
+            for ( rotator& r : rotators ) {
+                r.rotate_2(vmath::unit3_x<float>, 2.f);
+            }
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_invoke_method_batch(benchmark::State &state) {
+        meta::method m = meta::resolve_type<rotator>().get_method("rotate_2");
+        META_HPP_ASSERT(m.is_valid());
+
+        std::vector<rotator> rotators(batch_size);
+
+        for ( auto _ : state ) {
+            for ( rotator& r : rotators ) {
+                m(r, vmath::unit3_x<float>, 2.f);
+            }
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_invoke_batch_method_batch(benchmark::State &state) {
+        meta::method m = meta::resolve_type<rotator>().get_method("rotate_2");
+        META_HPP_ASSERT(m.is_valid());
+
+        std::vector<rotator> rotators(batch_size);
+
+        for ( auto _ : state ) {
+            m.invoke_batch(std::span{rotators}, vmath::unit3_x<float>, 2.f);
+        }
+    }
+
+    [[maybe_unused]]
+    void get_member_batch(benchmark::State &state) {
+        std::vector<rotator> rotators(batch_size);
+        std::vector<float> results(batch_size);
+
+        for ( auto _ : state ) {
+            for ( std::size_t i{}; i < batch_size; ++i ) {
+                results[i] = rotators[i].angle;
+            }
+            benchmark::DoNotOptimize(results.data());
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_get_member_batch(benchmark::State &state) {
+        meta::member m = meta::resolve_type<rotator>().get_member("angle");
+        META_HPP_ASSERT(m.is_valid());
+
+        std::vector<rotator> rotators(batch_size);
+        std::vector<meta::uvalue> results(batch_size);
+
+        for ( auto _ : state ) {
+            for ( std::size_t i{}; i < batch_size; ++i ) {
+                results[i] = m(rotators[i]);
+            }
+            benchmark::DoNotOptimize(results.data());
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_get_batch_member_batch(benchmark::State &state) {
+        meta::member m = meta::resolve_type<rotator>().get_member("angle");
+        META_HPP_ASSERT(m.is_valid());
+
+        std::vector<rotator> rotators(batch_size);
+        std::vector<meta::uvalue> results(batch_size);
+
+        for ( auto _ : state ) {
+            m.get_batch(std::span{rotators}, std::span{results});
+            benchmark::DoNotOptimize(results.data());
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_get_ref_member_batch(benchmark::State &state) {
+        meta::member m = meta::resolve_type<rotator>().get_member("angle");
+        META_HPP_ASSERT(m.is_valid());
+
+        std::vector<rotator> rotators(batch_size);
+        std::vector<float> results(batch_size);
+
+        for ( auto _ : state ) {
+            for ( std::size_t i{}; i < batch_size; ++i ) {
+                results[i] = m.get_ref<const float>(rotators[i]);
+            }
+            benchmark::DoNotOptimize(results.data());
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_read_raw_member_batch(benchmark::State &state) {
+        meta::member m = meta::resolve_type<rotator>().get_member("angle");
+        META_HPP_ASSERT(m.is_valid());
+
+        std::vector<rotator> rotators(batch_size);
+        std::vector<float> results(batch_size);
+
+        for ( auto _ : state ) {
+            for ( std::size_t i{}; i < batch_size; ++i ) {
+                m.read_raw(rotators[i], &results[i]);
+            }
+            benchmark::DoNotOptimize(results.data());
+        }
+    }
+}
+
+BENCHMARK(invoke_method_0)->Teardown(static_rotator_reset);
+BENCHMARK(meta_invoke_method_0)->Teardown(static_rotator_reset);
+BENCHMARK(meta_typed_invoke_method_0)->Teardown(static_rotator_reset);
+
+BENCHMARK(invoke_method_1)->Teardown(static_rotator_reset);
+BENCHMARK(meta_invoke_method_1)->Teardown(static_rotator_reset);
+BENCHMARK(meta_typed_invoke_method_1)->Teardown(static_rotator_reset);
+
+BENCHMARK(invoke_method_2)->Teardown(static_rotator_reset);
+BENCHMARK(meta_invoke_method_2)->Teardown(static_rotator_reset);
+BENCHMARK(meta_typed_invoke_method_2)->Teardown(static_rotator_reset);
+
+BENCHMARK(invoke_getter)->Teardown(static_rotator_reset);
+BENCHMARK(meta_invoke_getter)->Teardown(static_rotator_reset);
+BENCHMARK(meta_invoke_into_getter)->Teardown(static_rotator_reset);
+
+
+BENCHMARK(invoke_method_batch);
+BENCHMARK(meta_invoke_method_batch);
+BENCHMARK(meta_invoke_batch_method_batch);
+
+BENCHMARK(get_member_batch);
+BENCHMARK(meta_get_member_batch);
+BENCHMARK(meta_get_batch_member_batch);
+BENCHMARK(meta_get_ref_member_batch);
+BENCHMARK(meta_read_raw_member_batch);
\ No newline at end of file
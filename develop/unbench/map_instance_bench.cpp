@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    namespace meta = meta_hpp;
+
+    struct transform_dto {
+        float x{1.f};
+        float y{2.f};
+        float z{3.f};
+        float angle{4.f};
+        int layer{5};
+        std::string name{"transform, it's a long enough name"};
+    };
+
+    struct transform {
+        float x{};
+        float y{};
+        float z{};
+        float angle{};
+        int layer{};
+        std::string name;
+    };
+
+    const bool meta_bench_registered = []() {
+        meta::class_<transform_dto>()
+            .member_("x", &transform_dto::x)
+            .member_("y", &transform_dto::y)
+            .member_("z", &transform_dto::z)
+            .member_("angle", &transform_dto::angle)
+            .member_("layer", &transform_dto::layer)
+            .member_("name", &transform_dto::name);
+
+        meta::class_<transform>()
+            .member_("x", &transform::x)
+            .member_("y", &transform::y)
+            .member_("z", &transform::z)
+            .member_("angle", &transform::angle)
+            .member_("layer", &transform::layer)
+            .member_("name", &transform::name);
+        return true;
+    }();
+}
+
+namespace
+{
+    [[maybe_unused]]
+    void map_instance_native(benchmark::State &state) {
+        const transform_dto from;
+        transform to;
+
+        for ( auto _ : state ) {
+            to.x = from.x;
+            to.y = from.y;
+            to.z = from.z;
+            to.angle = from.angle;
+            to.layer = from.layer;
+            to.name = from.name;
+            benchmark::DoNotOptimize(to);
+        }
+    }
+
+    [[maybe_unused]]
+    void map_instance_members(benchmark::State &state) {
+        const meta::class_type from_type = meta::resolve_type<transform_dto>();
+        const meta::class_type to_type = meta::resolve_type<transform>();
+
+        const transform_dto from;
+        transform to;
+
+        for ( auto _ : state ) {
+            for ( const meta::member& to_member : to_type.get_members() ) {
+                if ( const meta::member from_member = from_type.get_member(to_member.get_name()) ) {
+                    to_member.set(to, from_member.get(from));
+                }
+            }
+            benchmark::DoNotOptimize(to);
+        }
+    }
+
+    [[maybe_unused]]
+    void map_instance_mapper(benchmark::State &state) {
+        const meta::instance_mapper mapper = meta::resolve_mapper<transform_dto, transform>();
+        META_HPP_ASSERT(mapper.is_valid());
+
+        const transform_dto from;
+        transform to;
+
+        for ( auto _ : state ) {
+            mapper.map(from, to);
+            benchmark::DoNotOptimize(to);
+        }
+    }
+}
+
+BENCHMARK(map_instance_native);
+BENCHMARK(map_instance_members);
+BENCHMARK(map_instance_mapper);
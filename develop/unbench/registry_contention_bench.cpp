@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    namespace meta = meta_hpp;
+
+    constexpr std::size_t scope_count{64};
+
+    std::string make_scope_name(std::size_t index) {
+        return "scope_" + std::to_string(index);
+    }
+
+    // the previous registry design: every read is serialized by one mutex
+
+    class locked_registry {
+    public:
+        [[nodiscard]] meta::scope resolve_scope(std::string_view name) {
+            const std::lock_guard lock{mutex_};
+            if ( auto iter{scopes_.find(name)}; iter != scopes_.end() ) {
+                return iter->second;
+            }
+            return scopes_.emplace(std::string{name}, meta::resolve_scope(name)).first->second;
+        }
+
+        template < typename F >
+        void for_each_scope(F&& f) {
+            const std::lock_guard lock{mutex_};
+            for ( auto&& [_, scope] : scopes_ ) {
+                std::invoke(f, scope);
+            }
+        }
+
+    private:
+        std::recursive_mutex mutex_;
+        std::map<std::string, meta::scope, std::less<>> scopes_;
+    };
+
+    locked_registry& get_locked_registry() {
+        static locked_registry registry;
+        return registry;
+    }
+
+    const std::vector<std::string>& get_scope_names() {
+        static const std::vector<std::string> names = []() {
+            std::vector<std::string> result;
+            for ( std::size_t i{}; i < scope_count; ++i ) {
+                result.push_back(make_scope_name(i));
+                std::ignore = meta::resolve_scope(result.back());
+                std::ignore = get_locked_registry().resolve_scope(result.back());
+            }
+            return result;
+        }();
+        return names;
+    }
+}
+
+namespace
+{
+    [[maybe_unused]]
+    void locked_resolve_scope(benchmark::State &state) {
+        const std::vector<std::string>& names = get_scope_names();
+        std::size_t index{static_cast<std::size_t>(state.thread_index())};
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(get_locked_registry().resolve_scope(names[index++ % scope_count]));
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_resolve_scope(benchmark::State &state) {
+        const std::vector<std::string>& names = get_scope_names();
+        std::size_t index{static_cast<std::size_t>(state.thread_index())};
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(meta::resolve_scope(names[index++ % scope_count]));
+        }
+    }
+
+    [[maybe_unused]]
+    void locked_for_each_scope(benchmark::State &state) {
+        std::ignore = get_scope_names();
+        for ( auto _ : state ) {
+            std::size_t count{};
+            get_locked_registry().for_each_scope([&count](const meta::scope&) { ++count; });
+            benchmark::DoNotOptimize(count);
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_for_each_scope(benchmark::State &state) {
+        std::ignore = get_scope_names();
+        for ( auto _ : state ) {
+            std::size_t count{};
+            meta::for_each_scope([&count](const meta::scope&) { ++count; });
+            benchmark::DoNotOptimize(count);
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_for_each_type(benchmark::State &state) {
+        for ( auto _ : state ) {
+            std::size_t count{};
+            meta::for_each_type([&count](const meta::any_type&) { ++count; });
+            benchmark::DoNotOptimize(count);
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_resolve_scope_while_registering(benchmark::State &state) {
+        const std::vector<std::string>& names = get_scope_names();
+        std::size_t index{static_cast<std::size_t>(state.thread_index())};
+        std::size_t registered{};
+        for ( auto _ : state ) {
+            // the first thread keeps registering new scopes, others only read
+            if ( state.thread_index() == 0 && index % 1024 == 0 ) {
+                std::ignore = meta::resolve_scope("registered_scope_" + std::to_string(registered++));
+            }
+            benchmark::DoNotOptimize(meta::resolve_scope(names[index++ % scope_count]));
+        }
+    }
+}
+
+BENCHMARK(locked_resolve_scope)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(meta_resolve_scope)->ThreadRange(1, 32)->UseRealTime();
+
+BENCHMARK(locked_for_each_scope)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(meta_for_each_scope)->ThreadRange(1, 32)->UseRealTime();
+
+BENCHMARK(meta_for_each_type)->ThreadRange(1, 32)->UseRealTime();
+
+BENCHMARK(meta_resolve_scope_while_registering)->ThreadRange(1, 32)->UseRealTime();
@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    namespace meta = meta_hpp;
+
+    constexpr std::size_t scope_count{400};
+    constexpr std::size_t function_count{1000};
+
+    template < std::size_t I >
+    std::size_t function() {
+        return I;
+    }
+
+    std::string make_scope_name(std::size_t index) {
+        return "scope_" + std::to_string(index);
+    }
+
+    std::string make_function_name(std::size_t index) {
+        return "function_" + std::to_string(index);
+    }
+
+    void bind_scopes() {
+        static const bool bound = []() {
+            for ( std::size_t i{}; i < scope_count; ++i ) {
+                std::ignore = meta::resolve_scope(make_scope_name(i));
+            }
+            []<std::size_t... Is>(std::index_sequence<Is...>) {
+                auto bind = meta::static_scope_(make_scope_name(scope_count - 1));
+                (bind.function_(make_function_name(Is), &function<Is>), ...);
+            }(std::make_index_sequence<function_count>());
+            return true;
+        }();
+        std::ignore = bound;
+    }
+
+    meta::function scan_function(const meta::scope& scope, std::string_view name) {
+        for ( const meta::function& function : scope.get_functions() ) {
+            if ( function.get_name() == name ) {
+                return function;
+            }
+        }
+        return meta::function{};
+    }
+}
+
+namespace
+{
+    [[maybe_unused]]
+    void scan_function_last(benchmark::State &state) {
+        bind_scopes();
+        const std::string scope_name = make_scope_name(scope_count - 1);
+        const std::string function_name = make_function_name(function_count - 1);
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(scan_function(meta::resolve_scope(scope_name), function_name));
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_get_function_last(benchmark::State &state) {
+        bind_scopes();
+        const std::string scope_name = make_scope_name(scope_count - 1);
+        const std::string function_name = make_function_name(function_count - 1);
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(meta::resolve_scope(scope_name).get_function(function_name));
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_resolve_function_last(benchmark::State &state) {
+        bind_scopes();
+        const std::string scope_name = make_scope_name(scope_count - 1);
+        const std::string function_name = make_function_name(function_count - 1);
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(meta::resolve_function(scope_name, function_name));
+        }
+    }
+
+    [[maybe_unused]]
+    void meta_resolve_function_missing(benchmark::State &state) {
+        bind_scopes();
+        const std::string scope_name = make_scope_name(scope_count - 1);
+        const std::string function_name = make_function_name(function_count);
+        for ( auto _ : state ) {
+            benchmark::DoNotOptimize(meta::resolve_function(scope_name, function_name));
+        }
+    }
+}
+
+BENCHMARK(scan_function_last);
+BENCHMARK(meta_get_function_last);
+BENCHMARK(meta_resolve_function_last);
+BENCHMARK(meta_resolve_function_missing);
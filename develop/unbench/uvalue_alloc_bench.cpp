@@ -0,0 +1,175 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    namespace meta = meta_hpp;
+
+    // these sizes are measured with the default inline buffer and with a wider one,
+    // build the bench with -DMETA_HPP_UVALUE_INLINE_SIZE=64 to compare them
+
+    template < std::size_t Size >
+    struct payload {
+        // NOLINTNEXTLINE(*-avoid-c-arrays)
+        std::byte data[Size]{};
+    };
+
+    struct vec3 {
+        float x{}, y{}, z{};
+    };
+
+    struct vec4 {
+        double x{}, y{}, z{}, w{};
+    };
+
+    struct matrix2 {
+        vec4 rows[2]{};
+    };
+
+    // a value stored outside of its uvalue costs an allocation
+    [[nodiscard]] bool is_allocated(const meta::uvalue& v) noexcept {
+        const auto* data = static_cast<const std::byte*>(v.get_data());
+        const auto* first = reinterpret_cast<const std::byte*>(&v); // NOLINT(*-reinterpret-cast)
+        return data < first || data >= first + sizeof(meta::uvalue);
+    }
+
+    template < typename T >
+    void report_allocations(benchmark::State& state, std::size_t allocations) {
+        state.counters["allocs"] = benchmark::Counter( //
+            static_cast<double>(allocations),
+            benchmark::Counter::kAvgIterations
+        );
+        state.counters["inline_size"] = static_cast<double>(META_HPP_UVALUE_INLINE_SIZE);
+        state.counters["value_size"] = static_cast<double>(sizeof(T));
+    }
+}
+
+namespace
+{
+    template < typename T >
+    [[maybe_unused]]
+    void uvalue_construct(benchmark::State& state) {
+        std::size_t allocations{};
+
+        for ( auto _ : state ) {
+            meta::uvalue v{T{}};
+            allocations += is_allocated(v) ? 1 : 0;
+            benchmark::DoNotOptimize(v);
+        }
+
+        report_allocations<T>(state, allocations);
+    }
+
+    template < typename T >
+    [[maybe_unused]]
+    void uvalue_construct_pooled(benchmark::State& state) {
+        meta::uvalue_pool_resource pool;
+        meta::uvalue_memory_resource* prev_resource{meta::set_thread_uvalue_resource(&pool)};
+
+        std::size_t allocations{};
+
+        for ( auto _ : state ) {
+            meta::uvalue v{T{}};
+            allocations += is_allocated(v) ? 1 : 0;
+            benchmark::DoNotOptimize(v);
+        }
+
+        meta::set_thread_uvalue_resource(prev_resource);
+        report_allocations<T>(state, allocations);
+    }
+
+    template < typename T >
+    [[maybe_unused]]
+    void uvalue_copy(benchmark::State& state) {
+        const meta::uvalue v{T{}};
+        std::size_t allocations{};
+
+        for ( auto _ : state ) {
+            meta::uvalue v2{v.as<T>()};
+            allocations += is_allocated(v2) ? 1 : 0;
+            benchmark::DoNotOptimize(v2);
+        }
+
+        report_allocations<T>(state, allocations);
+    }
+
+    template < typename T >
+    [[maybe_unused]]
+    void uvalue_list_push(benchmark::State& state) {
+        meta::uvalue_list list;
+        list.reserve(64);
+
+        std::size_t allocations{};
+
+        for ( auto _ : state ) {
+            for ( std::size_t i{}; i < 64; ++i ) {
+                allocations += is_allocated(list.emplace_back(T{})) ? 1 : 0;
+            }
+            benchmark::DoNotOptimize(list);
+            list.clear();
+        }
+
+        report_allocations<T>(state, allocations);
+    }
+
+    // one value published to many subscribers, as deep copies or as shared ones
+
+    [[maybe_unused]]
+    void uvalue_fan_out_copy(benchmark::State& state) {
+        const meta::uvalue v{std::vector<int>(1024)};
+
+        std::vector<meta::uvalue> subscribers;
+        subscribers.reserve(64);
+
+        for ( auto _ : state ) {
+            for ( std::size_t i{}; i < 64; ++i ) {
+                subscribers.push_back(v.copy());
+            }
+            benchmark::DoNotOptimize(subscribers);
+            subscribers.clear();
+        }
+    }
+
+    [[maybe_unused]]
+    void uvalue_fan_out_share(benchmark::State& state) {
+        const meta::uvalue v{meta::make_shared_uvalue<std::vector<int>>(1024)};
+
+        std::vector<meta::uvalue> subscribers;
+        subscribers.reserve(64);
+
+        for ( auto _ : state ) {
+            for ( std::size_t i{}; i < 64; ++i ) {
+                subscribers.push_back(v.copy());
+            }
+            benchmark::DoNotOptimize(subscribers);
+            subscribers.clear();
+        }
+    }
+}
+
+BENCHMARK(uvalue_construct<int>);
+BENCHMARK(uvalue_construct<vec3>);
+BENCHMARK(uvalue_construct<vec4>);
+BENCHMARK(uvalue_construct<matrix2>);
+BENCHMARK(uvalue_construct<payload<48>>);
+
+BENCHMARK(uvalue_construct_pooled<matrix2>);
+BENCHMARK(uvalue_construct_pooled<payload<48>>);
+
+BENCHMARK(uvalue_copy<vec3>);
+BENCHMARK(uvalue_copy<vec4>);
+BENCHMARK(uvalue_copy<matrix2>);
+
+BENCHMARK(uvalue_list_push<vec3>);
+BENCHMARK(uvalue_list_push<vec4>);
+BENCHMARK(uvalue_list_push<payload<48>>);
+
+BENCHMARK(uvalue_fan_out_copy);
+BENCHMARK(uvalue_fan_out_share);
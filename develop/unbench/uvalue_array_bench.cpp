@@ -0,0 +1,118 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    namespace meta = meta_hpp;
+
+    constexpr std::size_t column_size{1 << 16};
+
+    [[nodiscard]] int random_value(std::size_t index) noexcept {
+        // NOLINTNEXTLINE(*-magic-numbers)
+        return static_cast<int>((index * 2654435761U) % 1000003U);
+    }
+
+    [[nodiscard]] meta::uvalue_list make_list() {
+        meta::uvalue_list list;
+        list.reserve(column_size);
+
+        for ( std::size_t i{}; i < column_size; ++i ) {
+            list.emplace_back(random_value(i));
+        }
+
+        return list;
+    }
+
+    [[nodiscard]] meta::uvalue_array make_array() {
+        meta::uvalue_array array{std::in_place_type<int>};
+        array.reserve(column_size);
+
+        for ( std::size_t i{}; i < column_size; ++i ) {
+            array.emplace_back<int>(random_value(i));
+        }
+
+        return array;
+    }
+}
+
+namespace
+{
+    [[maybe_unused]]
+    void uvalue_list_sort(benchmark::State& state) {
+        for ( auto _ : state ) {
+            state.PauseTiming();
+            meta::uvalue_list list = make_list();
+            state.ResumeTiming();
+
+            std::sort(list.begin(), list.end(), [](const meta::uvalue& l, const meta::uvalue& r) {
+                return l.less(r); //
+            });
+
+            benchmark::DoNotOptimize(list);
+        }
+    }
+
+    [[maybe_unused]]
+    void uvalue_array_sort(benchmark::State& state) {
+        for ( auto _ : state ) {
+            state.PauseTiming();
+            meta::uvalue_array array{make_array()};
+            state.ResumeTiming();
+
+            array.sort();
+
+            benchmark::DoNotOptimize(array);
+        }
+    }
+
+    [[maybe_unused]]
+    void uvalue_list_equals(benchmark::State& state) {
+        const meta::uvalue_list l = make_list();
+        const meta::uvalue_list r = make_list();
+
+        for ( auto _ : state ) {
+            const bool equals = std::equal(l.begin(), l.end(), r.begin(), r.end(), [](const meta::uvalue& lv, const meta::uvalue& rv) {
+                return lv.equals(rv); //
+            });
+
+            benchmark::DoNotOptimize(equals);
+        }
+    }
+
+    [[maybe_unused]]
+    void uvalue_array_equals(benchmark::State& state) {
+        const meta::uvalue_array l{make_array()};
+        const meta::uvalue_array r{make_array()};
+
+        for ( auto _ : state ) {
+            const bool equals = l.equals(r);
+            benchmark::DoNotOptimize(equals);
+        }
+    }
+
+    [[maybe_unused]]
+    void uvalue_array_hashes(benchmark::State& state) {
+        const meta::uvalue_array array{make_array()};
+        std::vector<std::size_t> hashes(array.get_size());
+
+        for ( auto _ : state ) {
+            array.get_hashes(hashes);
+            benchmark::DoNotOptimize(hashes);
+        }
+    }
+}
+
+BENCHMARK(uvalue_list_sort);
+BENCHMARK(uvalue_array_sort);
+
+BENCHMARK(uvalue_list_equals);
+BENCHMARK(uvalue_array_equals);
+
+BENCHMARK(uvalue_array_hashes);
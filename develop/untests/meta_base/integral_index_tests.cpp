@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+TEST_CASE("meta/meta_base/integral_index") {
+    namespace meta = meta_hpp;
+    using meta::detail::integral_index;
+
+    SUBCASE("make_key") {
+        static_assert(integral_index::make_key(-1) < integral_index::make_key(0));
+        static_assert(integral_index::make_key(0) < integral_index::make_key(1));
+        static_assert(integral_index::make_key(std::int64_t{-1}) == integral_index::make_key(std::int8_t{-1}));
+        static_assert(integral_index::make_key(1u) == 1);
+    }
+
+    SUBCASE("empty") {
+        const integral_index index;
+        CHECK(index.empty());
+        CHECK_FALSE(index.is_dense());
+        CHECK(index.find(0) == integral_index::npos);
+    }
+
+    SUBCASE("dense") {
+        integral_index index;
+        index.assign({{12, 0}, {10, 1}, {11, 2}, {14, 3}, {12, 4}});
+
+        CHECK(index.is_dense());
+        CHECK(index.size() == 4);
+        CHECK(index.find(10) == 1);
+        CHECK(index.find(11) == 2);
+        CHECK(index.find(12) == 0);
+        CHECK(index.find(13) == integral_index::npos);
+        CHECK(index.find(14) == 3);
+        CHECK(index.find(9) == integral_index::npos);
+        CHECK(index.find(15) == integral_index::npos);
+    }
+
+    SUBCASE("sparse") {
+        integral_index index;
+        index.assign({{0xFF0000, 0}, {0x00FF00, 1}, {0x0000FF, 2}, {0x00FF00, 3}});
+
+        CHECK_FALSE(index.is_dense());
+        CHECK(index.size() == 3);
+        CHECK(index.find(0xFF0000) == 0);
+        CHECK(index.find(0x00FF00) == 1);
+        CHECK(index.find(0x0000FF) == 2);
+        CHECK(index.find(0) == integral_index::npos);
+        CHECK(index.find(0xFFFFFF) == integral_index::npos);
+    }
+
+    SUBCASE("clear") {
+        integral_index index;
+        index.assign({{1, 0}});
+        index.clear();
+        CHECK(index.empty());
+        CHECK(index.find(1) == integral_index::npos);
+    }
+}
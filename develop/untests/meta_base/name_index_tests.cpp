@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+TEST_CASE("meta/meta_base/name_index") {
+    namespace meta = meta_hpp;
+    using meta::detail::name_index;
+
+    SUBCASE("empty") {
+        const name_index index;
+        CHECK(index.empty());
+        CHECK(index.size() == 0);
+        CHECK(index.find("hello") == name_index::npos);
+    }
+
+    SUBCASE("assign") {
+        const std::string hello{"hello"};
+        const std::string world{"world"};
+
+        name_index index;
+        index.assign(hello, 0);
+        index.assign(world, 1);
+
+        CHECK_FALSE(index.empty());
+        CHECK(index.size() == 2);
+        CHECK(index.find("hello") == 0);
+        CHECK(index.find("world") == 1);
+        CHECK(index.find("other") == name_index::npos);
+    }
+
+    SUBCASE("keeps_first_position") {
+        const std::string hello{"hello"};
+
+        name_index index;
+        index.assign(hello, 1);
+        index.assign(hello, 2);
+        CHECK(index.size() == 1);
+        CHECK(index.find("hello") == 1);
+
+        index.assign(hello, 0);
+        CHECK(index.size() == 1);
+        CHECK(index.find("hello") == 0);
+    }
+
+    SUBCASE("rebinds_replaced_key") {
+        auto hello1 = std::make_unique<std::string>("hello");
+        auto hello2 = std::make_unique<std::string>("hello");
+
+        name_index index;
+        index.assign(*hello1, 0);
+        index.assign(*hello2, 0);
+        hello1.reset();
+
+        CHECK(index.size() == 1);
+        CHECK(index.find("hello") == 0);
+    }
+
+    SUBCASE("release") {
+        const std::string hello{"hello"};
+
+        name_index index;
+        index.assign(hello, 0);
+
+        index.release(hello, 1);
+        CHECK(index.find("hello") == 0);
+
+        index.release(hello, 0);
+        CHECK(index.empty());
+        CHECK(index.find("hello") == name_index::npos);
+    }
+
+    SUBCASE("releases_replaced_key") {
+        std::vector<std::unique_ptr<std::string>> names;
+        names.push_back(std::make_unique<std::string>("function_numbered_0"));
+        names.push_back(std::make_unique<std::string>("function_numbered_1"));
+
+        name_index index;
+        index.assign(*names[0], 0);
+        index.assign(*names[1], 1);
+
+        // replaces the names the same way binds replace states
+        for ( std::size_t i{}; i < names.size(); ++i ) {
+            index.release(*names[i], i);
+            names[i] = std::make_unique<std::string>(*names[i]);
+            index.assign(*names[i], i);
+        }
+
+        CHECK(index.size() == 2);
+        CHECK(index.find("function_numbered_0") == 0);
+        CHECK(index.find("function_numbered_1") == 1);
+    }
+
+    SUBCASE("clear") {
+        const std::string hello{"hello"};
+
+        name_index index;
+        index.assign(hello, 0);
+        index.clear();
+
+        CHECK(index.empty());
+        CHECK(index.find("hello") == name_index::npos);
+    }
+}
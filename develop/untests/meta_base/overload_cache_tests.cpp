@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+TEST_CASE("meta/meta_base/overload_cache") {
+    namespace meta = meta_hpp;
+    using meta::detail::overload_cache;
+
+    overload_cache cache;
+
+    const std::array<std::size_t, 2> shape1{1, 2};
+    const std::array<std::size_t, 2> shape2{2, 1};
+    const std::array<std::size_t, 0> shape3{};
+
+    SUBCASE("find") {
+        CHECK_FALSE(cache.find(shape1));
+        CHECK_FALSE(cache.find(shape3));
+
+        cache.insert(shape1, 0);
+        cache.insert(shape3, overload_cache::npos);
+
+        REQUIRE(cache.find(shape1));
+        CHECK(*cache.find(shape1) == 0);
+        CHECK_FALSE(cache.find(shape2));
+        REQUIRE(cache.find(shape3));
+        CHECK(*cache.find(shape3) == overload_cache::npos);
+    }
+
+    SUBCASE("insert") {
+        cache.insert(shape1, 0);
+        cache.insert(shape1, 1);
+        REQUIRE(cache.find(shape1));
+        CHECK(*cache.find(shape1) == 1);
+    }
+
+    SUBCASE("clear") {
+        cache.insert(shape1, 0);
+        cache.clear();
+        CHECK_FALSE(cache.find(shape1));
+
+        cache.insert(shape1, 1);
+        REQUIRE(cache.find(shape1));
+        CHECK(*cache.find(shape1) == 1);
+    }
+
+    SUBCASE("long_shape") {
+        const std::array<std::size_t, overload_cache::max_shape_size + 1> long_shape{};
+        cache.insert(long_shape, 0);
+        CHECK_FALSE(cache.find(long_shape));
+    }
+
+    SUBCASE("slots") {
+        for ( std::size_t i{}; i < overload_cache::slot_count * 4; ++i ) {
+            cache.insert(std::array<std::size_t, 1>{i}, i);
+        }
+
+        // a shape may be evicted by another one, but never found with a wrong position
+        for ( std::size_t i{}; i < overload_cache::slot_count * 4; ++i ) {
+            if ( const std::optional<std::size_t> position{cache.find(std::array<std::size_t, 1>{i})} ) {
+                CHECK(*position == i);
+            }
+        }
+    }
+}
+
+TEST_CASE("meta/meta_base/signature_index") {
+    namespace meta = meta_hpp;
+    using meta::detail::signature_index;
+
+    const meta::any_type_list args1{meta::resolve_type<int>()};
+    const meta::any_type_list args2{meta::resolve_type<int>(), meta::resolve_type<float>()};
+
+    const std::size_t signature1 = signature_index::make_signature("hello", args1.begin(), args1.end());
+    const std::size_t signature2 = signature_index::make_signature("hello", args2.begin(), args2.end());
+    CHECK(signature1 != signature2);
+    CHECK(signature1 == signature_index::make_signature("hello", args1.begin(), args1.end()));
+    CHECK(signature1 != signature_index::make_signature("world", args1.begin(), args1.end()));
+
+    signature_index index;
+    index.assign(signature1, 2);
+    index.assign(signature1, 1);
+    index.assign(signature1, 1);
+    index.assign(signature2, 0);
+    CHECK(index.size() == 3);
+
+    CHECK(index.find_first(signature1, [](std::size_t) { return true; }) == 1);
+    CHECK(index.find_first(signature1, [](std::size_t p) { return p == 2; }) == 2);
+    CHECK(index.find_first(signature1, [](std::size_t) { return false; }) == signature_index::npos);
+    CHECK(index.find_first(signature2, [](std::size_t) { return true; }) == 0);
+}
@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+#include <thread>
+
+TEST_CASE("meta/meta_base/published_list") {
+    namespace meta = meta_hpp;
+    using meta::detail::published_list;
+
+    SUBCASE("empty") {
+        const published_list<std::string> list;
+        CHECK(list.empty());
+        CHECK(list.size() == 0);
+    }
+
+    SUBCASE("push_back") {
+        published_list<std::string> list;
+
+        // crosses several segments
+        for ( std::size_t i{}; i < 1000; ++i ) {
+            CHECK(list.push_back(std::to_string(i)) == std::to_string(i));
+        }
+
+        CHECK_FALSE(list.empty());
+        CHECK(list.size() == 1000);
+
+        for ( std::size_t i{}; i < 1000; ++i ) {
+            CHECK(list[i] == std::to_string(i));
+        }
+
+        std::size_t count{};
+        list.for_each([&count](const std::string& value) { CHECK(value == std::to_string(count++)); });
+        CHECK(count == 1000);
+    }
+
+    SUBCASE("values_do_not_move") {
+        published_list<std::string> list;
+        const std::string* first = &list.push_back("first");
+
+        for ( std::size_t i{}; i < 100; ++i ) {
+            list.push_back(std::to_string(i));
+        }
+
+        CHECK(first == &list[0]);
+        CHECK(*first == "first");
+    }
+
+    SUBCASE("concurrent_readers") {
+        published_list<std::size_t> list;
+
+        std::atomic<bool> done{};
+        std::atomic<std::size_t> failures{};
+
+        std::vector<std::thread> readers;
+        for ( std::size_t i{}; i < 4; ++i ) {
+            readers.emplace_back([&list, &done, &failures]() {
+                while ( !done.load() ) {
+                    std::size_t expected{};
+                    list.for_each([&expected, &failures](std::size_t value) {
+                        if ( value != expected++ ) {
+                            ++failures;
+                        }
+                    });
+                }
+            });
+        }
+
+        for ( std::size_t i{}; i < 10000; ++i ) {
+            list.push_back(i);
+        }
+
+        done.store(true);
+        for ( std::thread& reader : readers ) {
+            reader.join();
+        }
+
+        CHECK(failures.load() == 0);
+        CHECK(list.size() == 10000);
+    }
+}
+
+TEST_CASE("meta/meta_base/published_index") {
+    namespace meta = meta_hpp;
+    using meta::detail::published_index;
+
+    const auto hash = [](std::string_view name) { return std::hash<std::string_view>{}(name); };
+
+    SUBCASE("empty") {
+        const published_index index;
+        CHECK(index.find(hash("hello"), [](std::size_t) { return true; }) == published_index::npos);
+    }
+
+    SUBCASE("insert") {
+        std::vector<std::string> names;
+        published_index index;
+
+        // crosses several table sizes
+        for ( std::size_t i{}; i < 1000; ++i ) {
+            names.push_back("name_" + std::to_string(i));
+            index.insert(hash(names.back()), names.size() - 1);
+        }
+
+        for ( std::size_t i{}; i < 1000; ++i ) {
+            const std::string name{"name_" + std::to_string(i)};
+            CHECK(index.find(hash(name), [&names, &name](std::size_t position) { return names[position] == name; }) == i);
+        }
+
+        CHECK(index.find(hash("other"), [&names](std::size_t position) { return names[position] == "other"; })
+              == published_index::npos);
+    }
+
+    SUBCASE("colliding_hashes") {
+        const std::vector<std::string> names{"hello", "world"};
+
+        published_index index;
+        index.insert(42, 0);
+        index.insert(42, 1);
+
+        CHECK(index.find(42, [&names](std::size_t position) { return names[position] == "hello"; }) == 0);
+        CHECK(index.find(42, [&names](std::size_t position) { return names[position] == "world"; }) == 1);
+        CHECK(index.find(42, [&names](std::size_t position) { return names[position] == "other"; }) == published_index::npos);
+    }
+}
@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+#include <thread>
+
+namespace
+{
+    template < std::size_t I >
+    struct clazz {};
+}
+
+TEST_CASE("meta/meta_features/concurrent_registry") {
+    namespace meta = meta_hpp;
+
+    SUBCASE("resolve_scope") {
+        std::vector<std::thread> threads;
+        std::vector<std::vector<meta::scope>> resolved(4);
+
+        for ( std::size_t i{}; i < resolved.size(); ++i ) {
+            threads.emplace_back([&scopes = resolved[i]]() {
+                for ( std::size_t j{}; j < 100; ++j ) {
+                    scopes.push_back(meta::resolve_scope("meta/meta_features/concurrent_registry/" + std::to_string(j)));
+                }
+            });
+        }
+
+        for ( std::thread& thread : threads ) {
+            thread.join();
+        }
+
+        for ( std::size_t j{}; j < 100; ++j ) {
+            const std::string name{"meta/meta_features/concurrent_registry/" + std::to_string(j)};
+            for ( const std::vector<meta::scope>& scopes : resolved ) {
+                CHECK(scopes[j] == meta::resolve_scope(name));
+                CHECK(scopes[j].get_name() == name);
+            }
+        }
+
+        std::size_t scope_count{};
+        meta::for_each_scope([&scope_count](const meta::scope& scope) {
+            if ( scope.get_name().starts_with("meta/meta_features/concurrent_registry/") ) {
+                ++scope_count;
+            }
+        });
+        CHECK(scope_count == 100);
+    }
+
+    SUBCASE("for_each_type") {
+        std::atomic<bool> done{};
+        std::atomic<std::size_t> failures{};
+
+        std::thread reader{[&done, &failures]() {
+            while ( !done.load() ) {
+                meta::for_each_type([&failures](const meta::any_type& type) {
+                    if ( !type.is_valid() ) {
+                        ++failures;
+                    }
+                });
+            }
+        }};
+
+        []<std::size_t... Is>(std::index_sequence<Is...>) {
+            (meta::resolve_type<clazz<Is>>(), ...);
+        }(std::make_index_sequence<64>());
+
+        done.store(true);
+        reader.join();
+
+        CHECK(failures.load() == 0);
+
+        std::size_t type_count{};
+        meta::for_each_type<meta::class_type>([&type_count](const meta::class_type& type) {
+            if ( type.get_size() == sizeof(clazz<0>) ) {
+                ++type_count;
+            }
+        });
+        CHECK(type_count >= 64);
+    }
+}
@@ -163,7 +163,7 @@ TEST_CASE("meta/meta_features/diamond") {
         {
             A a;
             meta::uvalue a_val{&a};
-            CHECK(*static_cast<A**>(a_val.get_data()) == &a);
+            CHECK(*static_cast<A* const*>(a_val.get_data()) == &a);
 
             uarg a_arg{r, a_val};
 
@@ -178,7 +178,7 @@ TEST_CASE("meta/meta_features/diamond") {
         {
             B b;
             meta::uvalue b_val{&b};
-            CHECK(*static_cast<B**>(b_val.get_data()) == &b);
+            CHECK(*static_cast<B* const*>(b_val.get_data()) == &b);
 
             uarg b_arg{r, b_val};
 
@@ -194,7 +194,7 @@ TEST_CASE("meta/meta_features/diamond") {
         {
             C c;
             meta::uvalue c_val{&c};
-            CHECK(*static_cast<C**>(c_val.get_data()) == &c);
+            CHECK(*static_cast<C* const*>(c_val.get_data()) == &c);
 
             uarg c_arg{r, c_val};
 
@@ -210,7 +210,7 @@ TEST_CASE("meta/meta_features/diamond") {
         {
             D d;
             meta::uvalue d_val{&d};
-            CHECK(*static_cast<D**>(d_val.get_data()) == &d);
+            CHECK(*static_cast<D* const*>(d_val.get_data()) == &d);
 
             uarg d_arg{r, d_val};
 
@@ -228,7 +228,7 @@ TEST_CASE("meta/meta_features/diamond") {
         {
             E e;
             meta::uvalue e_val{&e};
-            CHECK(*static_cast<E**>(e_val.get_data()) == &e);
+            CHECK(*static_cast<E* const*>(e_val.get_data()) == &e);
 
             uarg e_arg{r, e_val};
 
@@ -0,0 +1,229 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+namespace
+{
+    struct named_base {
+        std::string name;
+        int id{};
+
+        META_HPP_ENABLE_BASE_INFO()
+    };
+
+    struct named_point : named_base {
+        int x{};
+        int y{};
+
+        META_HPP_ENABLE_BASE_INFO(named_base)
+    };
+
+    struct point_dto {
+        int x{};
+        int y{};
+        int z{};
+        std::string name;
+        int weight{};
+        float scale{};
+        named_point* parent{};
+    };
+
+    struct point {
+        int x{};
+        int y{};
+        int z{};
+        std::string name;
+        double weight{};
+        float extra{};
+        const named_base* parent{};
+    };
+
+    struct shuffled_point {
+        int z{};
+        int y{};
+        int x{};
+    };
+
+    struct const_point {
+        const int x{};
+        int y{};
+    };
+}
+
+TEST_CASE("meta/meta_features/mapper/_") {
+    namespace meta = meta_hpp;
+
+    meta::class_<point_dto>()
+        .member_("x", &point_dto::x)
+        .member_("y", &point_dto::y)
+        .member_("z", &point_dto::z)
+        .member_("name", &point_dto::name)
+        .member_("weight", &point_dto::weight)
+        .member_("scale", &point_dto::scale)
+        .member_("parent", &point_dto::parent);
+
+    meta::class_<point>()
+        .member_("x", &point::x)
+        .member_("y", &point::y)
+        .member_("z", &point::z)
+        .member_("name", &point::name)
+        .member_("weight", &point::weight)
+        .member_("extra", &point::extra)
+        .member_("parent", &point::parent);
+
+    meta::class_<shuffled_point>()
+        .member_("x", &shuffled_point::x)
+        .member_("y", &shuffled_point::y)
+        .member_("z", &shuffled_point::z);
+
+    meta::class_<named_base>()
+        .member_("name", &named_base::name)
+        .member_("id", &named_base::id);
+
+    meta::class_<named_point>()
+        .member_("x", &named_point::x)
+        .member_("y", &named_point::y);
+
+    meta::class_<const_point>()
+        .member_("x", &const_point::x)
+        .member_("y", &const_point::y);
+}
+
+TEST_CASE("meta/meta_features/mapper") {
+    namespace meta = meta_hpp;
+
+    SUBCASE("plan") {
+        const meta::instance_mapper mapper = meta::resolve_mapper<point_dto, point>();
+        REQUIRE(mapper);
+
+        CHECK(mapper.get_from_type() == meta::resolve_type<point_dto>());
+        CHECK(mapper.get_to_type() == meta::resolve_type<point>());
+
+        // x, y, z, name and parent, an int can't be assigned to a double member
+        CHECK(mapper.get_mapped_count() == 5);
+
+        // x, y and z are adjacent in both classes
+        if constexpr ( std::is_standard_layout_v<point_dto> && std::is_standard_layout_v<point> ) {
+            CHECK(mapper.get_copy_count() == 1);
+        }
+
+        CHECK_FALSE(meta::instance_mapper{});
+        CHECK_FALSE(meta::resolve_mapper(meta::class_type{}, meta::resolve_type<point>()));
+    }
+
+    SUBCASE("map") {
+        named_point parent;
+        const point_dto dto{1, 2, 3, "a long enough name to be allocated", 42, 2.f, &parent};
+
+        point p;
+        p.weight = 10.0;
+        p.extra = 5.f;
+
+        CHECK_FALSE(meta::map_instance(dto, p));
+        CHECK(p.x == 1);
+        CHECK(p.y == 2);
+        CHECK(p.z == 3);
+        CHECK(p.name == "a long enough name to be allocated");
+        CHECK(p.weight == 10.0);
+        CHECK(p.extra == 5.f);
+        CHECK(p.parent == &parent);
+    }
+
+    SUBCASE("map/back") {
+        const point p{4, 5, 6, "name", 7.5, 1.f, nullptr};
+
+        point_dto dto;
+        dto.weight = 10;
+
+        CHECK_FALSE(meta::resolve_mapper<point, point_dto>().map(&p, &dto));
+        CHECK(dto.x == 4);
+        CHECK(dto.y == 5);
+        CHECK(dto.z == 6);
+        CHECK(dto.name == "name");
+        CHECK(dto.weight == 10);
+    }
+
+    SUBCASE("shuffled") {
+        const meta::instance_mapper mapper = meta::resolve_mapper<point_dto, shuffled_point>();
+        REQUIRE(mapper);
+        CHECK(mapper.get_mapped_count() == 3);
+
+        if constexpr ( std::is_standard_layout_v<point_dto> ) {
+            CHECK(mapper.get_copy_count() == 3);
+        }
+
+        const point_dto dto{1, 2, 3, "", 0, 0.f, nullptr};
+        shuffled_point p;
+
+        CHECK_FALSE(mapper.map(dto, p));
+        CHECK(p.x == 1);
+        CHECK(p.y == 2);
+        CHECK(p.z == 3);
+    }
+
+    SUBCASE("bases") {
+        const point_dto dto{1, 2, 3, "name", 42, 2.f, nullptr};
+
+        named_point p;
+        p.id = 10;
+
+        CHECK_FALSE(meta::map_instance(dto, p));
+        CHECK(p.x == 1);
+        CHECK(p.y == 2);
+        CHECK(p.name == "name");
+        CHECK(p.id == 10);
+
+        point_dto dto2;
+        CHECK_FALSE(meta::map_instance(p, dto2));
+        CHECK(dto2.x == 1);
+        CHECK(dto2.y == 2);
+        CHECK(dto2.name == "name");
+    }
+
+    SUBCASE("errors") {
+        const point_dto dto{1, 2, 3, "", 0, 0.f, nullptr};
+
+        const meta::instance_mapper mapper = meta::resolve_mapper<point_dto, point>();
+        REQUIRE(mapper);
+
+        point p;
+        CHECK(mapper.map(dto, std::as_const(p)).get_error() == meta::error_code::bad_const_access);
+        CHECK(mapper.map(dto, static_cast<point*>(nullptr)).get_error() == meta::error_code::bad_instance_cast);
+        CHECK(mapper.map(p, p).get_error() == meta::error_code::bad_instance_cast);
+    }
+
+    SUBCASE("readonly") {
+        const point_dto dto{1, 2, 3, "", 0, 0.f, nullptr};
+
+        const meta::instance_mapper mapper = meta::resolve_mapper<point_dto, const_point>();
+        REQUIRE(mapper);
+        CHECK(mapper.get_mapped_count() == 1);
+
+        const_point p;
+        CHECK_FALSE(mapper.map(dto, p));
+        CHECK(p.x == 0);
+        CHECK(p.y == 2);
+    }
+
+    SUBCASE("rebind") {
+        struct late_point {
+            int x{};
+            int y{};
+        };
+
+        meta::class_<late_point>()
+            .member_("x", &late_point::x);
+
+        CHECK(meta::resolve_mapper<point_dto, late_point>().get_mapped_count() == 1);
+
+        meta::class_<late_point>()
+            .member_("y", &late_point::y);
+
+        CHECK(meta::resolve_mapper<point_dto, late_point>().get_mapped_count() == 2);
+    }
+}
@@ -0,0 +1,179 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+#if defined(META_HPP_WITH_PROFILER)
+
+namespace
+{
+    struct profiled_ivec2 {
+        int x{};
+        int y{};
+
+        profiled_ivec2() = default;
+
+        profiled_ivec2(int nx, int ny)
+        : x{nx}
+        , y{ny} {}
+
+        [[nodiscard]] int length2() const {
+            return x * x + y * y;
+        }
+    };
+
+    int profiled_isum(int a, int b) {
+        return a + b;
+    }
+
+    const meta_hpp::profile_record* find_record(
+        const meta_hpp::profile_snapshot& snapshot,
+        meta_hpp::profile_kind kind,
+        std::string_view name
+    ) {
+        const auto iter = std::find_if(snapshot.begin(), snapshot.end(), [kind, name](const meta_hpp::profile_record& record) {
+            return record.kind == kind && record.name == name;
+        });
+        return iter != snapshot.end() ? &*iter : nullptr;
+    }
+}
+
+TEST_CASE("meta/meta_features/profiler/_") {
+    namespace meta = meta_hpp;
+
+    meta::class_<profiled_ivec2>()
+        .constructor_<int, int>()
+        .member_("profiled_x", &profiled_ivec2::x)
+        .method_("profiled_length2", &profiled_ivec2::length2);
+
+    meta::static_scope_("meta/meta_features/profiler")
+        .function_("profiled_isum", &profiled_isum);
+}
+
+TEST_CASE("meta/meta_features/profiler") {
+    namespace meta = meta_hpp;
+
+    const meta::scope scope = meta::resolve_scope("meta/meta_features/profiler");
+    REQUIRE(scope);
+
+    const meta::class_type ivec2_type = meta::resolve_type<profiled_ivec2>();
+    REQUIRE(ivec2_type);
+
+    meta::reset_profile();
+
+    SUBCASE("function") {
+        const meta::function isum = scope.get_function("profiled_isum");
+        REQUIRE(isum);
+
+        CHECK(isum.invoke(1, 2).as<int>() == 3);
+        CHECK(isum.try_invoke(1, 2));
+        CHECK_FALSE(isum.try_invoke(1));
+        CHECK_FALSE(isum.try_invoke(1, "2"));
+
+        const meta::profile_snapshot snapshot = meta::take_profile_snapshot();
+        const meta::profile_record* record = find_record(snapshot, meta::profile_kind::function, "profiled_isum");
+        REQUIRE(record);
+
+        CHECK(record->scope_name == "meta/meta_features/profiler");
+        CHECK_FALSE(record->owner_type);
+        CHECK(record->owner_hash == 0);
+
+        CHECK(record->stats.get_calls() == 4);
+        CHECK(record->stats.get_failures() == 2);
+        CHECK(record->stats.get_failures(meta::error_code::arity_mismatch) == 1);
+        CHECK(record->stats.get_failures(meta::error_code::argument_type_mismatch) == 1);
+
+        std::uint64_t histogram_calls{};
+        for ( const std::uint64_t calls : record->stats.get_histogram() ) {
+            histogram_calls += calls;
+        }
+        CHECK(histogram_calls == 4);
+
+        CHECK(record->stats.get_percentile_time(0.5) <= record->stats.get_percentile_time(0.99));
+    }
+
+    SUBCASE("class") {
+        const meta::uvalue v = ivec2_type.create(3, 4);
+        REQUIRE(v);
+
+        const meta::member x = ivec2_type.get_member("profiled_x");
+        REQUIRE(x);
+
+        const meta::method length2 = ivec2_type.get_method("profiled_length2");
+        REQUIRE(length2);
+
+        profiled_ivec2 iv{1, 2};
+        CHECK(x.get(iv).as<int>() == 1);
+        x.set(iv, 10);
+        CHECK_FALSE(x.try_set(std::as_const(iv), 20));
+        CHECK(length2.invoke(iv).as<int>() == 104);
+
+        const meta::profile_snapshot snapshot = meta::take_profile_snapshot();
+
+        const meta::profile_record* ctor_record = find_record(snapshot, meta::profile_kind::constructor, "");
+        REQUIRE(ctor_record);
+        CHECK(ctor_record->owner_type == ivec2_type);
+        CHECK(ctor_record->owner_hash == ivec2_type.get_id().get_hash());
+        CHECK(ctor_record->stats.get_calls() == 1);
+
+        const meta::profile_record* getter_record = find_record(snapshot, meta::profile_kind::member_getter, "profiled_x");
+        REQUIRE(getter_record);
+        CHECK(getter_record->stats.get_calls() == 1);
+
+        const meta::profile_record* setter_record = find_record(snapshot, meta::profile_kind::member_setter, "profiled_x");
+        REQUIRE(setter_record);
+        CHECK(setter_record->stats.get_calls() == 2);
+        CHECK(setter_record->stats.get_failures(meta::error_code::bad_const_access) == 1);
+
+        const meta::profile_record* method_record = find_record(snapshot, meta::profile_kind::method, "profiled_length2");
+        REQUIRE(method_record);
+        CHECK(method_record->stats.get_calls() == 1);
+        CHECK(method_record->stats.get_failures() == 0);
+    }
+
+    SUBCASE("reset") {
+        const meta::function isum = scope.get_function("profiled_isum");
+        REQUIRE(isum);
+
+        CHECK(isum.invoke(1, 2).as<int>() == 3);
+        CHECK(find_record(meta::take_profile_snapshot(), meta::profile_kind::function, "profiled_isum"));
+
+        meta::reset_profile();
+        CHECK_FALSE(find_record(meta::take_profile_snapshot(), meta::profile_kind::function, "profiled_isum"));
+    }
+
+    SUBCASE("report") {
+        const meta::function isum = scope.get_function("profiled_isum");
+        REQUIRE(isum);
+
+        CHECK(isum.invoke(1, 2).as<int>() == 3);
+        CHECK_FALSE(isum.try_invoke(1));
+
+        const meta::method length2 = ivec2_type.get_method("profiled_length2");
+        REQUIRE(length2);
+
+        profiled_ivec2 iv{1, 2};
+        CHECK(length2.invoke(iv).as<int>() == 5);
+
+        const meta::profile_snapshot snapshot = meta::take_profile_snapshot();
+
+        const std::string report = meta::make_profile_report(snapshot);
+        CHECK(report.find("meta/meta_features/profiler::profiled_isum") != std::string::npos);
+        CHECK(report.find("class@0x") != std::string::npos);
+        CHECK(report.find("::profiled_length2") != std::string::npos);
+        CHECK(report.find("class#") == std::string::npos);
+
+        const std::string json = meta::make_profile_json(snapshot);
+        CHECK(json.front() == '[');
+        CHECK(json.back() == ']');
+        CHECK(json.find(R"("state":"meta/meta_features/profiler::profiled_isum")") != std::string::npos);
+        CHECK(json.find(R"("calls":2)") != std::string::npos);
+        CHECK(json.find(R"("arity mismatch":1)") != std::string::npos);
+    }
+}
+
+#endif
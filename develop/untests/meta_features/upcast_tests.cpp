@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+namespace
+{
+    struct A {
+        int a{1};
+        META_HPP_ENABLE_BASE_INFO()
+    };
+
+    struct B {
+        int b{2};
+        META_HPP_ENABLE_BASE_INFO()
+    };
+
+    struct C : A, B {
+        int c{3};
+        META_HPP_ENABLE_BASE_INFO(A, B)
+    };
+
+    struct D : virtual C {
+        int d{4};
+        META_HPP_ENABLE_BASE_INFO(C)
+    };
+
+    struct E : D, B {
+        int e{5};
+        META_HPP_ENABLE_BASE_INFO(D, B)
+    };
+}
+
+TEST_CASE("meta/meta_features/upcast") {
+    namespace meta = meta_hpp;
+    using meta::detail::class_type_data;
+    using meta::detail::pointer_upcast;
+    using meta::detail::type_access;
+
+    // A   B
+    //  \ /
+    //   C
+    //   : (virtual)
+    //   D   B
+    //    \ /
+    //     E
+
+    const meta::class_type A_type = meta::resolve_type<A>();
+    const meta::class_type B_type = meta::resolve_type<B>();
+    const meta::class_type C_type = meta::resolve_type<C>();
+    const meta::class_type D_type = meta::resolve_type<D>();
+    const meta::class_type E_type = meta::resolve_type<E>();
+
+    SUBCASE("deep_upcasts") {
+        const class_type_data& C_data = *type_access(C_type);
+        const class_type_data& D_data = *type_access(D_type);
+        const class_type_data& E_data = *type_access(E_type);
+
+        CHECK(C_data.deep_upcasts.size() == 2);
+        CHECK(D_data.deep_upcasts.size() == 3);
+        CHECK(E_data.deep_upcasts.size() == 4);
+
+        CHECK(std::is_sorted(E_data.deep_upcasts.begin(), E_data.deep_upcasts.end(), [](auto&& l, auto&& r) {
+            return l.target < r.target;
+        }));
+
+        REQUIRE(C_data.find_upcast(B_type.get_id()));
+        CHECK(C_data.find_upcast(B_type.get_id())->has_offset);
+
+        REQUIRE(D_data.find_upcast(C_type.get_id()));
+        CHECK_FALSE(D_data.find_upcast(C_type.get_id())->has_offset);
+        CHECK(D_data.find_upcast(C_type.get_id())->is_valid());
+
+        REQUIRE(E_data.find_upcast(D_type.get_id()));
+        CHECK(E_data.find_upcast(D_type.get_id())->has_offset);
+
+        REQUIRE(E_data.find_upcast(B_type.get_id()));
+        CHECK_FALSE(E_data.find_upcast(B_type.get_id())->is_valid());
+
+        CHECK_FALSE(C_data.find_upcast(D_type.get_id()));
+    }
+
+    SUBCASE("pointer_upcast") {
+        E e;
+
+        CHECK(pointer_upcast(&e, E_type, D_type) == static_cast<D*>(&e));
+        CHECK(pointer_upcast(&e, E_type, C_type) == static_cast<C*>(&e));
+        CHECK(pointer_upcast(&e, E_type, A_type) == static_cast<A*>(&e));
+        CHECK_FALSE(pointer_upcast(&e, E_type, B_type));
+
+        C& c = e;
+        CHECK(pointer_upcast(&c, C_type, A_type) == static_cast<A*>(&c));
+        CHECK(pointer_upcast(&c, C_type, B_type) == static_cast<B*>(&c));
+        CHECK(static_cast<B*>(pointer_upcast(&c, C_type, B_type))->b == 2);
+    }
+
+    SUBCASE("is_a") {
+        using meta::detail::is_a;
+
+        CHECK(is_a(A_type, E_type));
+        CHECK(is_a(C_type, E_type));
+        CHECK(is_a(D_type, E_type));
+        CHECK_FALSE(is_a(B_type, E_type));
+        CHECK_FALSE(is_a(E_type, A_type));
+
+        CHECK(B_type.is_base_of(E_type));
+    }
+
+    SUBCASE("upcast_cache") {
+        using meta::detail::upcast_cache;
+        upcast_cache& cache = upcast_cache::instance();
+
+        upcast_cache::invalidate();
+        cache.reset_stats();
+
+        CHECK(meta::detail::is_a(A_type, E_type));
+        CHECK(cache.get_stats().hits == 0);
+        CHECK(cache.get_stats().misses == 1);
+
+        CHECK(meta::detail::is_a(A_type, E_type));
+        CHECK(A_type.is_base_of(E_type));
+        CHECK(cache.get_stats().hits == 2);
+        CHECK(cache.get_stats().misses == 1);
+
+        CHECK(cache.find_upcast(E_type, A_type) == type_access(E_type)->find_upcast(A_type.get_id()));
+        CHECK(cache.find_upcast(A_type, E_type) == nullptr);
+        CHECK(cache.find_upcast(A_type, E_type) == nullptr);
+        CHECK(cache.get_stats().hits == 4);
+        CHECK(cache.get_stats().misses == 2);
+
+        upcast_cache::invalidate();
+
+        CHECK(cache.find_upcast(E_type, A_type) == type_access(E_type)->find_upcast(A_type.get_id()));
+        CHECK(cache.get_stats().misses == 3);
+
+        cache.reset_stats();
+        CHECK(cache.get_stats().hits == 0);
+        CHECK(cache.get_stats().misses == 0);
+    }
+}
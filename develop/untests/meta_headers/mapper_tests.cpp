@@ -0,0 +1,16 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#if defined(META_HPP_HEADERS_BUILD)
+#    include <meta.hpp/meta_mapper.hpp>
+#else
+#    include <meta.hpp/meta_all.hpp>
+#endif
+
+#include <doctest/doctest.h>
+
+TEST_CASE("meta/meta_headers/mapper") {
+}
@@ -95,4 +95,12 @@ TEST_CASE("meta/meta_states/ctor2") {
         CHECK(ctor.is_variadic_invocable_with(params.begin(), params.end()));
         CHECK_FALSE(ctor.is_variadic_invocable_with(wrong_params.begin(), wrong_params.end()));
     }
+
+    {
+        CHECK(ctor.create_variadic(std::span{params}).as<ivec2>() == ivec2{1,2});
+        CHECK(ctor.create_variadic(std::span<const meta::uvalue>{params}).as<ivec2>() == ivec2{1,2});
+
+        CHECK((*ctor.try_create_variadic(std::span{params})).as<ivec2>() == ivec2{1,2});
+        CHECK(ctor.try_create_variadic(std::span{wrong_params}).get_error() == meta::error_code::arity_mismatch);
+    }
 }
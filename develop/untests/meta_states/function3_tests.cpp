@@ -38,6 +38,10 @@ namespace
             l.y += r.y;
             return std::move(l);
         }
+
+        static int isum(int a, int b, int c, int d, int e, int f, int g, int h, int i, int j) noexcept {
+            return a + b + c + d + e + f + g + h + i + j;
+        }
     };
 
     [[maybe_unused]]
@@ -52,7 +56,8 @@ TEST_CASE("meta/meta_states/function3/_") {
     meta::class_<ivec2>()
         .function_("iadd", &ivec2::iadd)
         .function_("iadd_inplace", &ivec2::iadd_inplace)
-        .function_("iadd_rvalue", &ivec2::iadd_rvalue);
+        .function_("iadd_rvalue", &ivec2::iadd_rvalue)
+        .function_("isum", &ivec2::isum);
 }
 
 TEST_CASE("meta/meta_states/function3") {
@@ -186,4 +191,47 @@ TEST_CASE("meta/meta_states/function3") {
             CHECK(params[0].as<ivec2>() == ivec2{4,6});
         }
     }
+
+    SUBCASE("spans") {
+        const meta::function func = ivec2_type.get_function("iadd_inplace");
+        REQUIRE(func);
+
+        {
+            CHECK(func.invoke_variadic(std::span{params}).as<ivec2>() == ivec2{4,6});
+            CHECK(params[0].as<ivec2>() == ivec2{4,6});
+
+            CHECK((*func.try_invoke_variadic(std::span{params})).as<ivec2>() == ivec2{7,10});
+            CHECK(params[0].as<ivec2>() == ivec2{7,10});
+        }
+
+        {
+            CHECK(func.try_invoke_variadic(std::span<const meta::uvalue>{params}).get_error()
+                == meta::error_code::argument_type_mismatch);
+            CHECK(func.try_invoke_variadic(std::span{params}.first(1)).get_error()
+                == meta::error_code::arity_mismatch);
+            CHECK(func.try_invoke_variadic(std::span{wrong_params}).get_error()
+                == meta::error_code::argument_type_mismatch);
+        }
+    }
+
+    SUBCASE("wide") {
+        const meta::function func = ivec2_type.get_function("isum");
+        REQUIRE(func);
+
+        // more arguments than fit in place
+        std::vector<meta::uvalue> wide_params;
+        std::vector<int> typed_wide_params;
+        for ( int i{1}; i <= 10; ++i ) {
+            wide_params.emplace_back(i);
+            typed_wide_params.push_back(i);
+        }
+
+        CHECK(func.invoke_variadic(wide_params.begin(), wide_params.end()).as<int>() == 55);
+        CHECK(func.invoke_variadic(typed_wide_params.begin(), typed_wide_params.end()).as<int>() == 55);
+        CHECK(func.invoke_variadic(std::span{wide_params}).as<int>() == 55);
+        CHECK(func.invoke_variadic(std::span<const meta::uvalue>{wide_params}).as<int>() == 55);
+
+        CHECK(func.is_variadic_invocable_with(wide_params.begin(), wide_params.end()));
+        CHECK_FALSE(func.is_variadic_invocable_with(wide_params.begin(), wide_params.end() - 1));
+    }
 }
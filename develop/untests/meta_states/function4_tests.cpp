@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+namespace
+{
+    struct ivec2 {
+        int x{};
+        int y{};
+
+        static ivec2 iadd(const ivec2& l, const ivec2& r) noexcept {
+            return {l.x + r.x, l.y + r.y};
+        }
+
+        static const std::string& name() {
+            static std::string name{"ivec2, it's a long enough name"};
+            return name;
+        }
+
+        static int& counter() noexcept {
+            static int counter{};
+            return counter;
+        }
+
+        static void reset_counter() noexcept {
+            counter() = 0;
+        }
+    };
+
+    [[maybe_unused]]
+    bool operator==(const ivec2& l, const ivec2& r) noexcept {
+        return l.x == r.x && l.y == r.y;
+    }
+}
+
+TEST_CASE("meta/meta_states/function4/_") {
+    namespace meta = meta_hpp;
+
+    meta::class_<ivec2>()
+        .function_("iadd", &ivec2::iadd)
+        .function_("name", &ivec2::name)
+        .function_("counter", &ivec2::counter, meta::function_policy::return_reference_as_pointer)
+        .function_("reset_counter", &ivec2::reset_counter);
+}
+
+TEST_CASE("meta/meta_states/function4") {
+    namespace meta = meta_hpp;
+    using namespace std::string_literals;
+
+    const meta::class_type ivec2_type = meta::resolve_type<ivec2>();
+    REQUIRE(ivec2_type);
+
+    SUBCASE("invoke_into/uvalue") {
+        const meta::function iadd = ivec2_type.get_function("iadd");
+        REQUIRE(iadd);
+
+        meta::uvalue result;
+        iadd.invoke_into(result, ivec2{1, 2}, ivec2{3, 4});
+        CHECK(result.as<ivec2>() == ivec2{4, 6});
+
+        iadd.invoke_into(result, result.as<ivec2>(), ivec2{1, 1});
+        CHECK(result.as<ivec2>() == ivec2{5, 7});
+    }
+
+    SUBCASE("invoke_into/uvalue/reuse") {
+        const meta::function name = ivec2_type.get_function("name");
+        REQUIRE(name);
+
+        meta::uvalue result;
+        name.invoke_into(result);
+        CHECK(result.as<std::string>() == ivec2::name());
+
+        const void* result_data = result.get_data();
+        const char* result_chars = result.as<std::string>().data();
+
+        name.invoke_into(result);
+        CHECK(result.as<std::string>() == ivec2::name());
+        CHECK(result.get_data() == result_data);
+        CHECK(result.as<std::string>().data() == result_chars);
+    }
+
+    SUBCASE("invoke_into/uvalue/void") {
+        const meta::function reset_counter = ivec2_type.get_function("reset_counter");
+        REQUIRE(reset_counter);
+
+        meta::uvalue result{42};
+        reset_counter.invoke_into(result);
+        CHECK_FALSE(result);
+    }
+
+    SUBCASE("invoke_into/memory") {
+        const meta::function name = ivec2_type.get_function("name");
+        REQUIRE(name);
+
+        alignas(std::string) std::byte mem[sizeof(std::string)];
+        name.invoke_into(static_cast<void*>(mem));
+
+        std::string* result = std::launder(reinterpret_cast<std::string*>(mem));
+        CHECK(*result == ivec2::name());
+        std::destroy_at(result);
+    }
+
+    SUBCASE("invoke_into/uvalue/policy") {
+        const meta::function counter = ivec2_type.get_function("counter");
+        REQUIRE(counter);
+
+        // raw memory receives only copies, other policies are invoked into uvalues
+        meta::uvalue result;
+        counter.invoke_into(result);
+        CHECK(result.as<int*>() == &ivec2::counter());
+    }
+}
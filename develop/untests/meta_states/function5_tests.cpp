@@ -0,0 +1,287 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+#if defined(META_HPP_WITH_ASYNC)
+
+namespace
+{
+    struct inline_executor {
+        int posted{};
+
+        void post(std::function<void()> task) {
+            ++posted;
+            task();
+        }
+    };
+
+    int isum(int a, int b) {
+        return a + b;
+    }
+
+    void iinc(int& v) {
+        ++v;
+    }
+
+#if !defined(META_HPP_NO_COROUTINES)
+    template < typename T >
+    class lazy_task {
+    public:
+        struct promise_type {
+            T value{};
+            std::coroutine_handle<> continuation{};
+
+            lazy_task get_return_object() {
+                return lazy_task{std::coroutine_handle<promise_type>::from_promise(*this)};
+            }
+
+            std::suspend_always initial_suspend() noexcept {
+                return {};
+            }
+
+            auto final_suspend() noexcept {
+                struct final_awaiter {
+                    bool await_ready() noexcept {
+                        return false;
+                    }
+
+                    std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+                        const std::coroutine_handle<> continuation{handle.promise().continuation};
+                        return continuation ? continuation : std::noop_coroutine();
+                    }
+
+                    void await_resume() noexcept {}
+                };
+                return final_awaiter{};
+            }
+
+            void return_value(T v) {
+                value = std::move(v);
+            }
+
+            void unhandled_exception() {
+                std::terminate();
+            }
+        };
+
+        lazy_task(lazy_task&& other) noexcept
+        : handle_{std::exchange(other.handle_, nullptr)} {}
+
+        lazy_task& operator=(lazy_task&&) = delete;
+
+        ~lazy_task() {
+            if ( handle_ ) {
+                handle_.destroy();
+            }
+        }
+
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept {
+            handle_.promise().continuation = continuation;
+            return handle_;
+        }
+
+        T await_resume() {
+            return std::move(handle_.promise().value);
+        }
+
+    private:
+        explicit lazy_task(std::coroutine_handle<promise_type> handle)
+        : handle_{handle} {}
+
+    private:
+        std::coroutine_handle<promise_type> handle_;
+    };
+
+    struct eager_value {
+        int value{};
+
+        auto operator co_await() && noexcept {
+            struct awaiter {
+                int value{};
+
+                bool await_ready() noexcept {
+                    return true;
+                }
+
+                void await_suspend(std::coroutine_handle<>) noexcept {}
+
+                int await_resume() noexcept {
+                    return value;
+                }
+            };
+            return awaiter{value};
+        }
+    };
+
+    struct detached {
+        struct promise_type {
+            detached get_return_object() noexcept {
+                return {};
+            }
+
+            std::suspend_never initial_suspend() noexcept {
+                return {};
+            }
+
+            std::suspend_never final_suspend() noexcept {
+                return {};
+            }
+
+            void return_void() noexcept {}
+
+            void unhandled_exception() {
+                std::terminate();
+            }
+        };
+    };
+
+    lazy_task<int> lazy_isum(int a, int b) {
+        co_return a + b;
+    }
+
+    eager_value eager_isum(int a, int b) {
+        return eager_value{a + b};
+    }
+
+    template < typename Awaitable = void >
+    detached await_invoke(const meta_hpp::function& function, int a, int b, int& out) {
+        const meta_hpp::uvalue result = co_await meta_hpp::co_invoke<Awaitable>(function, a, b);
+        out = result.as<int>();
+    }
+#endif
+}
+
+TEST_CASE("meta/meta_states/function5/_") {
+    namespace meta = meta_hpp;
+
+    meta::static_scope_("meta/meta_states/function5")
+        .function_("isum", &isum)
+        .function_("iinc", &iinc)
+#if !defined(META_HPP_NO_COROUTINES)
+        .function_("lazy_isum", &lazy_isum)
+        .function_("eager_isum", &eager_isum)
+#endif
+        ;
+}
+
+TEST_CASE("meta/meta_states/function5") {
+    namespace meta = meta_hpp;
+
+    const meta::scope scope = meta::resolve_scope("meta/meta_states/function5");
+    REQUIRE(scope);
+
+    SUBCASE("invoke_async/thread_pool") {
+        const meta::function f = scope.get_function("isum");
+        REQUIRE(f);
+
+        meta::thread_pool pool{2};
+        CHECK(pool.get_thread_count() == 2);
+
+        std::vector<std::future<meta::uvalue>> futures;
+        for ( int i{}; i < 16; ++i ) {
+            futures.push_back(meta::invoke_async(pool, f, i, 10));
+        }
+
+        for ( int i{}; i < 16; ++i ) {
+            CHECK(futures[static_cast<std::size_t>(i)].get().as<int>() == i + 10);
+        }
+    }
+
+    SUBCASE("invoke_async/executor") {
+        const meta::function f = scope.get_function("iinc");
+        REQUIRE(f);
+
+        inline_executor executor;
+
+        int v{41};
+        std::future<meta::uvalue> future = meta::invoke_async(executor, f, std::ref(v));
+        CHECK(executor.posted == 1);
+        CHECK_FALSE(future.get());
+        CHECK(v == 42);
+    }
+
+#if !defined(META_HPP_NO_EXCEPTIONS)
+    SUBCASE("invoke_async/errors") {
+        const meta::function f = scope.get_function("isum");
+        REQUIRE(f);
+
+        inline_executor executor;
+
+        std::future<meta::uvalue> arity_future = meta::invoke_async(executor, f, 1);
+        CHECK_THROWS(std::ignore = arity_future.get());
+
+        std::future<meta::uvalue> type_future = meta::invoke_async(executor, f, 1, "2");
+        CHECK_THROWS(std::ignore = type_future.get());
+    }
+#endif
+
+#if !defined(META_HPP_NO_COROUTINES)
+    SUBCASE("co_invoke/ready") {
+        const meta::function f = scope.get_function("isum");
+        REQUIRE(f);
+
+        meta::uawaiter awaiter{meta::co_invoke(f, 20, 22)};
+        CHECK(awaiter.await_ready());
+        CHECK(awaiter.await_resume().as<int>() == 42);
+
+        int out{};
+        await_invoke(f, 1, 2, out);
+        CHECK(out == 3);
+    }
+
+    SUBCASE("co_invoke/awaiter") {
+        const meta::function f = scope.get_function("lazy_isum");
+        REQUIRE(f);
+
+        meta::uawaiter awaiter{meta::co_invoke<lazy_task<int>>(f, 20, 22)};
+        CHECK_FALSE(awaiter.await_ready());
+
+        int out{};
+        await_invoke<lazy_task<int>>(f, 20, 22, out);
+        CHECK(out == 42);
+    }
+
+    SUBCASE("co_invoke/awaitable") {
+        const meta::function f = scope.get_function("eager_isum");
+        REQUIRE(f);
+
+        meta::uawaiter awaiter{meta::co_invoke<eager_value>(f, 20, 22)};
+        CHECK(awaiter.await_ready());
+        CHECK(awaiter.await_resume().as<int>() == 42);
+
+        int out{};
+        await_invoke<eager_value>(f, 1, 2, out);
+        CHECK(out == 3);
+    }
+
+#if !defined(META_HPP_NO_EXCEPTIONS)
+    SUBCASE("co_invoke/errors") {
+        const meta::function f = scope.get_function("isum");
+        REQUIRE(f);
+
+        // the awaitable type must match the returned one
+        CHECK_THROWS(std::ignore = meta::co_invoke<eager_value>(f, 1, 2));
+    }
+#endif
+
+    SUBCASE("co_invoke/invoke") {
+        const meta::function f = scope.get_function("lazy_isum");
+        REQUIRE(f);
+
+        // the plain invoke still returns the task itself
+        const meta::uvalue task = f.invoke(1, 2);
+        CHECK(task.get_type() == meta::resolve_type<lazy_task<int>>());
+    }
+#endif
+}
+
+#endif
@@ -0,0 +1,103 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+namespace
+{
+    struct tagged {
+        std::string tag;
+
+        META_HPP_ENABLE_POLY_INFO()
+    };
+
+    struct position {
+        int x{};
+        int y{};
+
+        META_HPP_ENABLE_POLY_INFO()
+    };
+
+    struct unit : tagged, position {
+        META_HPP_ENABLE_POLY_INFO(tagged, position)
+    };
+}
+
+TEST_CASE("meta/meta_states/member2/_") {
+    namespace meta = meta_hpp;
+
+    meta::class_<tagged>()
+        .member_("tag", &tagged::tag);
+
+    meta::class_<position>()
+        .member_("x", &position::x)
+        .member_("y", &position::y, meta::member_policy::as_pointer);
+
+    meta::class_<unit>();
+}
+
+TEST_CASE("meta/meta_states/member2") {
+    namespace meta = meta_hpp;
+
+    const meta::class_type tagged_type = meta::resolve_type<tagged>();
+    const meta::class_type position_type = meta::resolve_type<position>();
+    REQUIRE((tagged_type && position_type));
+
+    const meta::member tag = tagged_type.get_member("tag");
+    const meta::member x = position_type.get_member("x");
+    const meta::member y = position_type.get_member("y");
+    REQUIRE((tag && x && y));
+
+    std::vector<unit> units(3);
+    for ( int i{}; i < 3; ++i ) {
+        units[static_cast<std::size_t>(i)].tag = "unit, it's a long enough tag";
+        units[static_cast<std::size_t>(i)].x = i;
+        units[static_cast<std::size_t>(i)].y = i * 10;
+    }
+
+    SUBCASE("get_batch/objects") {
+        std::vector<meta::uvalue> results(units.size());
+        CHECK_FALSE(x.get_batch(std::span{units}, std::span{results}));
+
+        CHECK(results[0].as<int>() == 0);
+        CHECK(results[1].as<int>() == 1);
+        CHECK(results[2].as<int>() == 2);
+
+        CHECK_FALSE(tag.get_batch(std::span<const unit>{units}, std::span{results}));
+
+        for ( const meta::uvalue& result : results ) {
+            CHECK(result.as<std::string>() == "unit, it's a long enough tag");
+        }
+    }
+
+    SUBCASE("get_batch/pointers") {
+        std::vector<const unit*> pointers{&units[2], &units[1]};
+        std::vector<meta::uvalue> results(pointers.size());
+
+        CHECK_FALSE(y.get_batch(std::span{pointers}, std::span{results}));
+
+        CHECK(results[0].as<const int*>() == &units[2].y);
+        CHECK(results[1].as<const int*>() == &units[1].y);
+    }
+
+    SUBCASE("get_batch/reuse") {
+        std::vector<meta::uvalue> results(units.size());
+        CHECK_FALSE(tag.get_batch(std::span{units}, std::span{results}));
+
+        const void* tag_data = results[0].as<std::string>().data();
+        CHECK_FALSE(tag.get_batch(std::span{units}, std::span{results}));
+        CHECK(results[0].as<std::string>().data() == tag_data);
+    }
+
+    SUBCASE("get_batch/errors") {
+        std::vector<tagged> taggeds(2);
+        std::vector<meta::uvalue> results(taggeds.size());
+
+        CHECK(x.get_batch(std::span{taggeds}, std::span{results}) == meta::uerror{meta::error_code::bad_instance_cast});
+        CHECK_FALSE(results[0].has_value());
+    }
+}
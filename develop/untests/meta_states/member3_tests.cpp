@@ -0,0 +1,155 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+namespace
+{
+    struct raw_ivec2 {
+        int x{};
+        int y{};
+        const int id{42};
+    };
+
+    struct raw_named {
+        std::string name;
+        double weight{};
+    };
+
+    struct raw_base {
+        virtual ~raw_base() = default;
+        float scale{};
+
+        META_HPP_ENABLE_BASE_INFO()
+    };
+
+    struct raw_derived : raw_base {
+        int level{};
+
+        META_HPP_ENABLE_BASE_INFO(raw_base)
+    };
+}
+
+TEST_CASE("meta/meta_states/member3/_") {
+    namespace meta = meta_hpp;
+
+    meta::class_<raw_ivec2>()
+        .member_("x", &raw_ivec2::x)
+        .member_("y", &raw_ivec2::y)
+        .member_("id", &raw_ivec2::id);
+
+    meta::class_<raw_named>()
+        .member_("name", &raw_named::name)
+        .member_("weight", &raw_named::weight);
+
+    meta::class_<raw_base>()
+        .member_("scale", &raw_base::scale);
+
+    meta::class_<raw_derived>()
+        .member_("level", &raw_derived::level);
+}
+
+TEST_CASE("meta/meta_states/member3") {
+    namespace meta = meta_hpp;
+
+    const meta::class_type ivec2_type = meta::resolve_type<raw_ivec2>();
+    const meta::class_type named_type = meta::resolve_type<raw_named>();
+    const meta::class_type derived_type = meta::resolve_type<raw_derived>();
+    REQUIRE((ivec2_type && named_type && derived_type));
+
+    const meta::member x = ivec2_type.get_member("x");
+    const meta::member y = ivec2_type.get_member("y");
+    const meta::member id = ivec2_type.get_member("id");
+    REQUIRE((x && y && id));
+
+    SUBCASE("offsets") {
+        CHECK(x.has_offset());
+        CHECK(x.get_offset() == 0);
+
+        CHECK(y.has_offset());
+        CHECK(y.get_offset() == static_cast<std::ptrdiff_t>(sizeof(int)));
+
+        const meta::member name = named_type.get_member("name");
+        REQUIRE(name);
+        CHECK(name.has_offset() == std::is_standard_layout_v<raw_named>);
+
+        const meta::member scale = derived_type.get_member("scale");
+        REQUIRE(scale);
+        CHECK_FALSE(scale.has_offset());
+    }
+
+    SUBCASE("get_ref") {
+        raw_ivec2 v{1, 2};
+
+        CHECK(&x.get_ref<int>(v) == &v.x);
+        CHECK(&y.get_ref<const int>(&v) == &v.y);
+        CHECK(&id.get_ref<const int>(std::as_const(v)) == &v.id);
+
+        y.get_ref<int>(v) = 20;
+        CHECK(v.y == 20);
+
+#if !defined(META_HPP_NO_EXCEPTIONS)
+        CHECK_THROWS(std::ignore = x.get_ref<float>(v));
+        CHECK_THROWS(std::ignore = x.get_ref<int>(std::as_const(v)));
+        CHECK_THROWS(std::ignore = id.get_ref<int>(v));
+        CHECK_THROWS(std::ignore = x.get_ref<int>(static_cast<raw_ivec2*>(nullptr)));
+#endif
+    }
+
+    SUBCASE("read_raw/write_raw") {
+        raw_ivec2 v{1, 2};
+
+        int value{};
+        CHECK_FALSE(y.read_raw(v, &value));
+        CHECK(value == 2);
+
+        value = 10;
+        CHECK_FALSE(x.write_raw(&v, &value));
+        CHECK(v.x == 10);
+
+        CHECK(x.write_raw(std::as_const(v), &value).get_error() == meta::error_code::bad_const_access);
+        CHECK(id.write_raw(v, &value).get_error() == meta::error_code::bad_const_access);
+        CHECK_FALSE(id.read_raw(std::as_const(v), &value));
+        CHECK(value == 42);
+
+        const meta::member weight = named_type.get_member("weight");
+        REQUIRE(weight);
+        CHECK(weight.read_raw(v, &value).get_error() == meta::error_code::bad_instance_cast);
+    }
+
+    SUBCASE("non-trivially copyable") {
+        const meta::member name = named_type.get_member("name");
+        REQUIRE(name);
+
+        raw_named n{"hello", 1.0};
+
+        std::string value;
+        CHECK_FALSE(name.read_raw(n, &value));
+        CHECK(value == "hello");
+
+        value = "a long enough string to be allocated outside";
+        CHECK_FALSE(name.write_raw(n, &value));
+        CHECK(n.name == "a long enough string to be allocated outside");
+    }
+
+    SUBCASE("upcast") {
+        const meta::member scale = derived_type.get_member("scale");
+        const meta::member level = derived_type.get_member("level");
+        REQUIRE((scale && level));
+
+        raw_derived d;
+        d.scale = 2.f;
+        d.level = 3;
+
+        CHECK(&scale.get_ref<float>(d) == &d.scale);
+        CHECK(&level.get_ref<int>(d) == &d.level);
+
+        const float new_scale{4.f};
+        CHECK_FALSE(scale.write_raw(&d, &new_scale));
+        CHECK(d.scale == 4.f);
+    }
+}
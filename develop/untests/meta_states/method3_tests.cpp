@@ -164,4 +164,21 @@ TEST_CASE("meta/meta_states/method3") {
             CHECK(params[0].as<ivec2>() == ivec2{4,6});
         }
     }
+
+    SUBCASE("spans") {
+        const meta::method meth = ivec2_type.get_method("add_reverse");
+        REQUIRE(meth);
+
+        {
+            CHECK(meth.invoke_variadic(ivec2{1,2}, std::span{params}).as<ivec2>() == ivec2{4,6});
+            CHECK(params[0].as<ivec2>() == ivec2{4,6});
+        }
+
+        {
+            CHECK(meth.try_invoke_variadic(ivec2{1,2}, std::span<const meta::uvalue>{params}).get_error()
+                == meta::error_code::argument_type_mismatch);
+            CHECK(meth.try_invoke_variadic(ivec2{1,2}, std::span{params}.first(0)).get_error()
+                == meta::error_code::arity_mismatch);
+        }
+    }
 }
@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+namespace
+{
+    struct base {
+        std::string name{"base, it's a long enough name"};
+
+        virtual ~base() = default;
+
+        [[nodiscard]] const std::string& get_name() const {
+            return name;
+        }
+
+        META_HPP_ENABLE_POLY_INFO()
+    };
+
+    struct derived : base {
+        int value{};
+
+        [[nodiscard]] int get_value() const noexcept {
+            return value;
+        }
+
+        void set_value(int v) noexcept {
+            value = v;
+        }
+
+        META_HPP_ENABLE_POLY_INFO(base)
+    };
+}
+
+TEST_CASE("meta/meta_states/method4/_") {
+    namespace meta = meta_hpp;
+
+    meta::class_<base>()
+        .method_("get_name", &base::get_name);
+
+    meta::class_<derived>()
+        .method_("get_value", &derived::get_value)
+        .method_("set_value", &derived::set_value);
+}
+
+TEST_CASE("meta/meta_states/method4") {
+    namespace meta = meta_hpp;
+
+    const meta::class_type base_type = meta::resolve_type<base>();
+    const meta::class_type derived_type = meta::resolve_type<derived>();
+    REQUIRE((base_type && derived_type));
+
+    SUBCASE("invoke_into/uvalue") {
+        const meta::method get_name = base_type.get_method("get_name");
+        REQUIRE(get_name);
+
+        derived d;
+        meta::uvalue result;
+        get_name.invoke_into(result, d);
+        CHECK(result.as<std::string>() == d.name);
+
+        const void* result_data = result.get_data();
+        const char* result_chars = result.as<std::string>().data();
+
+        d.name = "next, it's a long enough name";
+        get_name.invoke_into(result, &d);
+        CHECK(result.as<std::string>() == d.name);
+        CHECK(result.get_data() == result_data);
+        CHECK(result.as<std::string>().data() == result_chars);
+    }
+
+    SUBCASE("invoke_into/uvalue/void") {
+        const meta::method set_value = derived_type.get_method("set_value");
+        REQUIRE(set_value);
+
+        derived d;
+        meta::uvalue result{42};
+        set_value.invoke_into(result, d, 10);
+        CHECK_FALSE(result);
+        CHECK(d.value == 10);
+    }
+
+    SUBCASE("invoke_into/memory") {
+        const meta::method get_value = derived_type.get_method("get_value");
+        REQUIRE(get_value);
+
+        derived d;
+        d.value = 42;
+
+        int result{};
+        get_value.invoke_into(static_cast<void*>(&result), std::as_const(d));
+        CHECK(result == 42);
+    }
+}
@@ -0,0 +1,148 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+namespace
+{
+    struct named {
+        std::string name;
+
+        META_HPP_ENABLE_POLY_INFO()
+    };
+
+    struct counter {
+        int count{};
+
+        virtual ~counter() = default;
+
+        void add(int v) noexcept {
+            count += v;
+        }
+
+        [[nodiscard]] int get() const noexcept {
+            return count;
+        }
+
+        META_HPP_ENABLE_POLY_INFO()
+    };
+
+    struct entity : named, counter {
+        void rename(std::string new_name) {
+            name = std::move(new_name);
+        }
+
+        [[nodiscard]] std::string greet(const std::string& prefix) const {
+            return prefix + name;
+        }
+
+        META_HPP_ENABLE_POLY_INFO(named, counter)
+    };
+}
+
+TEST_CASE("meta/meta_states/method5/_") {
+    namespace meta = meta_hpp;
+
+    meta::class_<counter>()
+        .method_("add", &counter::add)
+        .method_("get", &counter::get);
+
+    meta::class_<entity>()
+        .method_("rename", &entity::rename)
+        .method_("greet", &entity::greet);
+}
+
+TEST_CASE("meta/meta_states/method5") {
+    namespace meta = meta_hpp;
+
+    const meta::class_type counter_type = meta::resolve_type<counter>();
+    const meta::class_type entity_type = meta::resolve_type<entity>();
+    REQUIRE((counter_type && entity_type));
+
+    const meta::method add = counter_type.get_method("add");
+    const meta::method get = counter_type.get_method("get");
+    const meta::method rename = entity_type.get_method("rename");
+    const meta::method greet = entity_type.get_method("greet");
+    REQUIRE((add && get && rename && greet));
+
+    SUBCASE("invoke_batch/objects") {
+        std::vector<entity> entities(3);
+
+        CHECK_FALSE(add.invoke_batch(std::span{entities}, 2));
+        CHECK_FALSE(add.invoke_batch(std::span{entities}, meta::uvalue{3}));
+
+        for ( const entity& e : entities ) {
+            CHECK(e.count == 5);
+        }
+    }
+
+    SUBCASE("invoke_batch/pointers") {
+        std::vector<entity> entities(3);
+        std::vector<entity*> pointers{&entities[0], &entities[2]};
+
+        CHECK_FALSE(add.invoke_batch(std::span{pointers}, 4));
+
+        CHECK(entities[0].count == 4);
+        CHECK(entities[1].count == 0);
+        CHECK(entities[2].count == 4);
+    }
+
+    SUBCASE("invoke_batch/results") {
+        std::vector<entity> entities(2);
+        entities[0].count = 10;
+        entities[1].count = 20;
+
+        std::vector<meta::uvalue> results(entities.size());
+        CHECK_FALSE(get.invoke_batch(std::span<const entity>{entities}, std::span{results}));
+
+        CHECK(results[0].as<int>() == 10);
+        CHECK(results[1].as<int>() == 20);
+
+        entities[0].name = "first";
+        entities[1].name = "second";
+        CHECK_FALSE(greet.invoke_batch(std::span{entities}, std::span{results}, std::string{"hi, "}));
+
+        CHECK(results[0].as<std::string>() == "hi, first");
+        CHECK(results[1].as<std::string>() == "hi, second");
+    }
+
+    SUBCASE("invoke_batch/values") {
+        std::vector<entity> entities(3);
+
+        // every call gets its own copy of a moved argument
+        std::string name{"it's a long enough name to be allocated"};
+        CHECK_FALSE(rename.invoke_batch(std::span{entities}, std::move(name)));
+
+        for ( const entity& e : entities ) {
+            CHECK(e.name == "it's a long enough name to be allocated");
+        }
+
+        CHECK_FALSE(rename.invoke_batch(std::span{entities}, meta::uvalue{std::string{"it's another long enough name"}}));
+
+        for ( const entity& e : entities ) {
+            CHECK(e.name == "it's another long enough name");
+        }
+    }
+
+    SUBCASE("invoke_batch/empty") {
+        CHECK_FALSE(add.invoke_batch(std::span<entity>{}, 1));
+    }
+
+    SUBCASE("invoke_batch/errors") {
+        std::vector<entity> entities(2);
+        std::vector<named> nameds(2);
+
+        CHECK(add.invoke_batch(std::span<const entity>{entities}, 1) == meta::uerror{meta::error_code::instance_type_mismatch});
+        CHECK(add.invoke_batch(std::span{nameds}, 1) == meta::uerror{meta::error_code::instance_type_mismatch});
+        CHECK(add.invoke_batch(std::span{entities}) == meta::uerror{meta::error_code::arity_mismatch});
+        CHECK(add.invoke_batch(std::span{entities}, "one") == meta::uerror{meta::error_code::argument_type_mismatch});
+
+        for ( const entity& e : entities ) {
+            CHECK(e.count == 0);
+        }
+    }
+}
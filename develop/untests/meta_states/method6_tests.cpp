@@ -0,0 +1,157 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+#if defined(META_HPP_WITH_ASYNC)
+
+namespace
+{
+    struct inline_executor {
+        void post(std::function<void()> task) {
+            task();
+        }
+    };
+
+#if !defined(META_HPP_NO_COROUTINES)
+    struct deferred_value {
+        int value{};
+
+        bool await_ready() noexcept {
+            return false;
+        }
+
+        bool await_suspend(std::coroutine_handle<>) noexcept {
+            // don't suspend after all, the caller resumes immediately
+            return false;
+        }
+
+        int await_resume() noexcept {
+            return value;
+        }
+    };
+#endif
+
+    struct counter {
+        int count{};
+
+        int add(int v) {
+            return count += v;
+        }
+
+#if !defined(META_HPP_NO_COROUTINES)
+        [[nodiscard]] deferred_value deferred_get() const {
+            return deferred_value{count};
+        }
+#endif
+    };
+
+#if !defined(META_HPP_NO_COROUTINES)
+    struct detached {
+        struct promise_type {
+            detached get_return_object() noexcept {
+                return {};
+            }
+
+            std::suspend_never initial_suspend() noexcept {
+                return {};
+            }
+
+            std::suspend_never final_suspend() noexcept {
+                return {};
+            }
+
+            void return_void() noexcept {}
+
+            void unhandled_exception() {
+                std::terminate();
+            }
+        };
+    };
+
+    detached await_invoke(const meta_hpp::method& method, const counter& instance, int& out) {
+        const meta_hpp::uvalue result = co_await meta_hpp::co_invoke<deferred_value>(method, instance);
+        out = result.as<int>();
+    }
+#endif
+}
+
+TEST_CASE("meta/meta_states/method6/_") {
+    namespace meta = meta_hpp;
+
+    meta::class_<counter>()
+        .method_("add", &counter::add)
+#if !defined(META_HPP_NO_COROUTINES)
+        .method_("deferred_get", &counter::deferred_get)
+#endif
+        ;
+}
+
+TEST_CASE("meta/meta_states/method6") {
+    namespace meta = meta_hpp;
+
+    const meta::class_type counter_type = meta::resolve_type<counter>();
+    REQUIRE(counter_type);
+
+    const meta::method add = counter_type.get_method("add");
+    REQUIRE(add);
+
+    SUBCASE("invoke_async/reference") {
+        meta::thread_pool pool{1};
+
+        counter c;
+        std::future<meta::uvalue> first = meta::invoke_async(pool, add, std::ref(c), 2);
+        CHECK(first.get().as<int>() == 2);
+
+        std::future<meta::uvalue> second = meta::invoke_async(pool, add, &c, 3);
+        CHECK(second.get().as<int>() == 5);
+
+        CHECK(c.count == 5);
+    }
+
+    SUBCASE("invoke_async/copy") {
+        inline_executor executor;
+
+        // the instance is copied into the task
+        counter c{10};
+        std::future<meta::uvalue> future = meta::invoke_async(executor, add, c, 2);
+        CHECK(future.get().as<int>() == 12);
+        CHECK(c.count == 10);
+    }
+
+#if !defined(META_HPP_NO_EXCEPTIONS)
+    SUBCASE("invoke_async/errors") {
+        inline_executor executor;
+
+        const counter c;
+        std::future<meta::uvalue> future = meta::invoke_async(executor, add, std::cref(c), 2);
+        CHECK_THROWS(std::ignore = future.get());
+    }
+#endif
+
+#if !defined(META_HPP_NO_COROUTINES)
+    SUBCASE("co_invoke") {
+        const meta::method deferred_get = counter_type.get_method("deferred_get");
+        REQUIRE(deferred_get);
+
+        counter c{42};
+
+        meta::uawaiter awaiter{meta::co_invoke<deferred_value>(deferred_get, c)};
+        CHECK_FALSE(awaiter.await_ready());
+
+        int out{};
+        await_invoke(deferred_get, c, out);
+        CHECK(out == 42);
+
+        meta::uawaiter ready{meta::co_invoke(add, c, 1)};
+        CHECK(ready.await_ready());
+        CHECK(ready.await_resume().as<int>() == 43);
+    }
+#endif
+}
+
+#endif
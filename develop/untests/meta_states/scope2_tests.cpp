@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+namespace
+{
+    int function_overloaded(int i0) { return i0; }
+    int function_overloaded(int i0, int i1) { return i0 + i1; }
+
+    template < int I >
+    int function_numbered() { return I; }
+
+    int static_int = 42;
+}
+
+TEST_CASE("meta/meta_states/scope2") {
+    namespace meta = meta_hpp;
+
+    meta::static_scope_("meta/meta_states/scope2")
+        .function_("function_overloaded", meta::select_overload<int(int)>(&function_overloaded))
+        .function_("function_overloaded", meta::select_overload<int(int,int)>(&function_overloaded))
+        .function_("function_numbered_0", &function_numbered<0>)
+        .function_("function_numbered_1", &function_numbered<1>)
+        .function_("function_numbered_2", &function_numbered<2>)
+        .variable_("static_int", &static_int);
+
+    const meta::scope scope = meta::resolve_scope("meta/meta_states/scope2");
+    REQUIRE(scope);
+
+    SUBCASE("get_function") {
+        CHECK(scope.get_function("function_numbered_0").invoke().as<int>() == 0);
+        CHECK(scope.get_function("function_numbered_1").invoke().as<int>() == 1);
+        CHECK(scope.get_function("function_numbered_2").invoke().as<int>() == 2);
+        CHECK_FALSE(scope.get_function("function_numbered_3"));
+
+        // the first bound overload is found by name
+        CHECK(scope.get_function("function_overloaded").get_type() == meta::resolve_type<int(int)>());
+    }
+
+    SUBCASE("get_function_with") {
+        CHECK(scope.get_function_with<int>("function_overloaded").invoke(1).as<int>() == 1);
+        CHECK(scope.get_function_with<int, int>("function_overloaded").invoke(1, 2).as<int>() == 3);
+        CHECK_FALSE(scope.get_function_with<float>("function_overloaded"));
+        CHECK_FALSE(scope.get_function_with<int>("function_numbered_0"));
+        CHECK(scope.get_function_with<>("function_numbered_0"));
+    }
+
+    SUBCASE("get_variable") {
+        CHECK(scope.get_variable("static_int").get().as<int>() == 42);
+        CHECK_FALSE(scope.get_variable("static_float"));
+    }
+
+    SUBCASE("rebind") {
+        meta::static_scope_("meta/meta_states/scope2/rebind")
+            .function_("function", &function_numbered<0>)
+            .function_("function", &function_numbered<1>);
+
+        const meta::scope rebind_scope = meta::resolve_scope("meta/meta_states/scope2/rebind");
+        CHECK(rebind_scope.get_functions().size() == 1);
+        CHECK(rebind_scope.get_function("function").invoke().as<int>() == 1);
+        CHECK(rebind_scope.get_function_with<>("function").invoke().as<int>() == 1);
+    }
+
+    SUBCASE("resolve_function") {
+        CHECK(meta::resolve_function("meta/meta_states/scope2", "function_numbered_1").invoke().as<int>() == 1);
+        CHECK(meta::resolve_function("meta/meta_states/scope2", "function_overloaded") == scope.get_function("function_overloaded"));
+        CHECK_FALSE(meta::resolve_function("meta/meta_states/scope2", "function_numbered_3"));
+        CHECK_FALSE(meta::resolve_function("meta/meta_states/scope2/missing", "function_numbered_1"));
+
+        // doesn't create missing scopes
+        std::size_t missing_scopes{};
+        meta::for_each_scope([&missing_scopes](const meta::scope& scope) {
+            missing_scopes += scope.get_name() == "meta/meta_states/scope2/missing" ? 1 : 0;
+        });
+        CHECK(missing_scopes == 0);
+    }
+}
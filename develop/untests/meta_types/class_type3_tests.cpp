@@ -0,0 +1,273 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+#include <thread>
+
+namespace
+{
+    struct clazz {
+        int int_member{1};
+        float float_member{2.f};
+
+        int method(int v) const { return v; }
+        float method(float v) const { return v * 2.f; }
+
+        static int function(int v) { return v; }
+        static float function(float v) { return v * 2.f; }
+
+        static int int_variable;
+    };
+
+    int clazz::int_variable{3};
+
+    struct base_clazz_1 {
+        int base_member_1{};
+        int method() const { return 1; }
+        META_HPP_ENABLE_BASE_INFO()
+    };
+
+    struct base_clazz_2 {
+        int base_member_2{};
+        int method() const { return 2; }
+        META_HPP_ENABLE_BASE_INFO()
+    };
+
+    struct derived_clazz : base_clazz_1, base_clazz_2 {
+        int derived_member{};
+        int method() const { return 3; }
+        META_HPP_ENABLE_BASE_INFO(base_clazz_1, base_clazz_2)
+    };
+}
+
+TEST_CASE("meta/meta_types/class_type3") {
+    namespace meta = meta_hpp;
+    using namespace std::string_literals;
+
+    meta::class_<clazz>()
+        .member_("int_member", &clazz::int_member)
+        .member_("float_member", &clazz::float_member)
+        .method_("method", meta::select_overload<int(int) const>(&clazz::method))
+        .method_("method", meta::select_overload<float(float) const>(&clazz::method))
+        .function_("function", meta::select_overload<int(int)>(&clazz::function))
+        .function_("function", meta::select_overload<float(float)>(&clazz::function))
+        .variable_("int_variable", &clazz::int_variable);
+
+    const meta::class_type clazz_type = meta::resolve_type<clazz>();
+    REQUIRE(clazz_type);
+
+    SUBCASE("first_overload") {
+        CHECK(clazz_type.get_method("method") == clazz_type.get_methods()[0]);
+        CHECK(clazz_type.get_function("function") == clazz_type.get_functions()[0]);
+        CHECK(clazz_type.get_member("float_member") == clazz_type.get_members()[1]);
+        CHECK(clazz_type.get_variable("int_variable") == clazz_type.get_variables()[0]);
+
+        CHECK_FALSE(clazz_type.get_method("function"));
+        CHECK_FALSE(clazz_type.get_function("method"));
+        CHECK_FALSE(clazz_type.get_member("int_variable"));
+        CHECK_FALSE(clazz_type.get_variable("int_member"));
+    }
+
+    SUBCASE("rebinding") {
+        meta::class_<clazz>()
+            .method_("method", meta::select_overload<int(int) const>(&clazz::method), meta::metadata_()("desc", "rebound"s))
+            .member_("int_member", &clazz::int_member, meta::metadata_()("desc", "rebound"s));
+
+        CHECK(clazz_type.get_methods().size() == 2);
+        CHECK(clazz_type.get_members().size() == 2);
+
+        const meta::method method = clazz_type.get_method("method");
+        REQUIRE(method);
+        CHECK(method.get_type() == meta::resolve_type<int (clazz::*)(int) const>());
+        CHECK(method.get_metadata().find("desc")->second.as<std::string>() == "rebound");
+
+        const meta::member member = clazz_type.get_member("int_member");
+        REQUIRE(member);
+        CHECK(member.get_metadata().find("desc")->second.as<std::string>() == "rebound");
+    }
+}
+
+TEST_CASE("meta/meta_types/class_type3/flat_lookup") {
+    namespace meta = meta_hpp;
+
+    meta::class_<base_clazz_1>()
+        .member_("base_member_1", &base_clazz_1::base_member_1)
+        .method_("method", &base_clazz_1::method)
+        .typedef_<int>("typedef");
+
+    meta::class_<base_clazz_2>()
+        .member_("base_member_2", &base_clazz_2::base_member_2)
+        .method_("method", &base_clazz_2::method)
+        .typedef_<float>("typedef");
+
+    meta::class_<derived_clazz>()
+        .member_("derived_member", &derived_clazz::derived_member);
+
+    const meta::class_type base_clazz_1_type = meta::resolve_type<base_clazz_1>();
+    const meta::class_type base_clazz_2_type = meta::resolve_type<base_clazz_2>();
+    const meta::class_type derived_clazz_type = meta::resolve_type<derived_clazz>();
+
+    SUBCASE("override_order") {
+        CHECK(derived_clazz_type.get_member("derived_member", true));
+        CHECK(derived_clazz_type.get_member("base_member_1", true) == base_clazz_1_type.get_member("base_member_1"));
+        CHECK(derived_clazz_type.get_member("base_member_2", true) == base_clazz_2_type.get_member("base_member_2"));
+
+        CHECK_FALSE(derived_clazz_type.get_member("base_member_1", false));
+        CHECK_FALSE(derived_clazz_type.get_method("method", false));
+
+        CHECK(derived_clazz_type.get_method("method", true) == base_clazz_2_type.get_method("method"));
+        CHECK(derived_clazz_type.get_typedef("typedef", true) == meta::resolve_type<float>());
+
+        CHECK_FALSE(derived_clazz_type.get_method("other_method", true));
+        CHECK_FALSE(derived_clazz_type.get_typedef("other_typedef", true));
+    }
+
+    SUBCASE("rebinding") {
+        CHECK_FALSE(derived_clazz_type.get_function("function", true));
+        CHECK_FALSE(derived_clazz_type.get_variable("variable", true));
+
+        static int variable{42};
+        meta::class_<base_clazz_1>()
+            .function_("function", +[]() { return 1; })
+            .variable_("variable", &variable);
+
+        CHECK(derived_clazz_type.get_function("function", true) == base_clazz_1_type.get_function("function"));
+        CHECK(derived_clazz_type.get_variable("variable", true) == base_clazz_1_type.get_variable("variable"));
+
+        meta::class_<derived_clazz>()
+            .method_("method", &derived_clazz::method);
+
+        const meta::method method = derived_clazz_type.get_method("method", true);
+        REQUIRE(method);
+        CHECK(method == derived_clazz_type.get_method("method", false));
+        CHECK(method != base_clazz_2_type.get_method("method"));
+    }
+
+    SUBCASE("open_bind") {
+        {
+            static int other_variable{21};
+            auto bind = meta::class_<base_clazz_2>();
+            bind.variable_("other_variable", &other_variable);
+
+            // the table is published when the bind ends, the bases are visited until then
+            CHECK(derived_clazz_type.get_variable("other_variable", true) == base_clazz_2_type.get_variable("other_variable"));
+            CHECK(derived_clazz_type.get_member("base_member_1", true) == base_clazz_1_type.get_member("base_member_1"));
+        }
+
+        CHECK(derived_clazz_type.get_variable("other_variable", true) == base_clazz_2_type.get_variable("other_variable"));
+    }
+
+    SUBCASE("threads") {
+        std::atomic<int> found{};
+
+        std::vector<std::thread> threads;
+        for ( std::size_t i{}; i < 4; ++i ) {
+            threads.emplace_back([&derived_clazz_type, &found]() {
+                for ( std::size_t j{}; j < 1000; ++j ) {
+                    found += derived_clazz_type.get_method("method", true) ? 1 : 0;
+                }
+            });
+        }
+
+        for ( std::thread& thread : threads ) {
+            thread.join();
+        }
+
+        CHECK(found == 4 * 1000);
+    }
+
+    SUBCASE("purging") {
+        using meta::detail::type_access;
+
+        meta::class_<base_clazz_1>()
+            .member_("base_member_1", &base_clazz_1::base_member_1);
+
+        CHECK(type_access(base_clazz_1_type)->flat_lookup_tables.size() > 1);
+        CHECK(type_access(derived_clazz_type)->flat_lookup_tables.size() > 1);
+
+        meta::purge_binds_(base_clazz_1_type);
+
+        CHECK(type_access(base_clazz_1_type)->flat_lookup_tables.size() == 1);
+        CHECK(type_access(derived_clazz_type)->flat_lookup_tables.size() == 1);
+
+        CHECK_FALSE(derived_clazz_type.get_member("base_member_1", true));
+        CHECK(derived_clazz_type.get_member("base_member_2", true) == base_clazz_2_type.get_member("base_member_2"));
+    }
+}
+
+namespace
+{
+    struct ivec2 {
+        int x{};
+        int y{};
+
+        ivec2() = default;
+        explicit ivec2(int v) : x{v}, y{v} {}
+        ivec2(int nx, int ny) : x{nx}, y{ny} {}
+
+        int dot(const ivec2& other) const { return x * other.x + y * other.y; }
+        int dot(int v) const { return x * v + y * v; }
+    };
+}
+
+TEST_CASE("meta/meta_types/class_type3/overloads") {
+    namespace meta = meta_hpp;
+
+    meta::class_<ivec2>()
+        .constructor_<>()
+        .constructor_<int>()
+        .method_("dot", meta::select_overload<int(const ivec2&) const>(&ivec2::dot))
+        .method_("dot", meta::select_overload<int(int) const>(&ivec2::dot));
+
+    const meta::class_type ivec2_type = meta::resolve_type<ivec2>();
+    REQUIRE(ivec2_type);
+
+    SUBCASE("get_with") {
+        CHECK(ivec2_type.get_constructor_with<>() == ivec2_type.get_constructors()[0]);
+        CHECK(ivec2_type.get_constructor_with<int>() == ivec2_type.get_constructors()[1]);
+        CHECK_FALSE(ivec2_type.get_constructor_with<int, int>());
+
+        CHECK(ivec2_type.get_method_with<const ivec2&>("dot") == ivec2_type.get_methods()[0]);
+        CHECK(ivec2_type.get_method_with<int>("dot") == ivec2_type.get_methods()[1]);
+        CHECK_FALSE(ivec2_type.get_method_with<float>("dot"));
+        CHECK_FALSE(ivec2_type.get_method_with<int>("cross"));
+    }
+
+    SUBCASE("create") {
+        for ( int i = 0; i < 2; ++i ) {
+            const meta::uvalue v0 = ivec2_type.create();
+            REQUIRE(v0);
+            CHECK(v0.as<ivec2>().x == 0);
+
+            const meta::uvalue v1 = ivec2_type.create(i + 1);
+            REQUIRE(v1);
+            CHECK(v1.as<ivec2>().y == i + 1);
+
+            CHECK_FALSE(ivec2_type.create(1, 2));
+            CHECK_FALSE(ivec2_type.create(meta::uvalue{1}, meta::uvalue{2}));
+        }
+
+        meta::class_<ivec2>()
+            .constructor_<int, int>();
+
+        CHECK(ivec2_type.get_constructor_with<int, int>() == ivec2_type.get_constructors()[2]);
+
+        const meta::uvalue v2 = ivec2_type.create(meta::uvalue{1}, meta::uvalue{2});
+        REQUIRE(v2);
+        CHECK(v2.as<ivec2>().x == 1);
+        CHECK(v2.as<ivec2>().y == 2);
+
+        // with more overloads the choice is remembered for each shape of arguments
+        for ( int i = 0; i < 2; ++i ) {
+            CHECK(ivec2_type.create(i).as<ivec2>().x == i);
+            CHECK(ivec2_type.create(i, 2).as<ivec2>().x == i);
+            CHECK_FALSE(ivec2_type.create(1.f, 2.f, 3.f));
+            CHECK_FALSE(ivec2_type.create(1, 2, 3, 4, 5));
+        }
+    }
+}
@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+namespace
+{
+    enum class level : signed char {
+        trace = -2,
+        debug = -1,
+        info = 0,
+        warning = 1,
+        error = 2,
+    };
+
+    enum class mask : std::uint64_t {
+        none = 0,
+        low = 1,
+        high = std::uint64_t{1} << 63,
+    };
+}
+
+TEST_CASE("meta/meta_types/enum_type2") {
+    namespace meta = meta_hpp;
+
+    meta::enum_<level>()
+        .evalue_("trace", level::trace)
+        .evalue_("debug", level::debug)
+        .evalue_("info", level::info)
+        .evalue_("warning", level::warning)
+        .evalue_("error", level::error);
+
+    meta::enum_<mask>()
+        .evalue_("none", mask::none)
+        .evalue_("low", mask::low)
+        .evalue_("high", mask::high);
+
+    const meta::enum_type level_type = meta::resolve_type<level>();
+    const meta::enum_type mask_type = meta::resolve_type<mask>();
+
+    SUBCASE("value_to_name") {
+        CHECK(level_type.value_to_name(level::trace) == "trace");
+        CHECK(level_type.value_to_name(level::info) == "info");
+        CHECK(level_type.value_to_name(level::error) == "error");
+        CHECK(level_type.value_to_name(level{3}).empty());
+        CHECK(level_type.value_to_name(mask::low).empty());
+
+        CHECK(level_type.value_to_name(meta::uvalue{level::debug}) == "debug");
+        CHECK(level_type.value_to_name(meta::uvalue{level{-3}}).empty());
+        CHECK(level_type.value_to_name(meta::uvalue{-1}).empty());
+
+        CHECK(mask_type.value_to_name(mask::none) == "none");
+        CHECK(mask_type.value_to_name(mask::high) == "high");
+        CHECK(mask_type.value_to_name(meta::uvalue{mask::high}) == "high");
+        CHECK(mask_type.value_to_name(mask{2}).empty());
+    }
+
+    SUBCASE("name_to_value") {
+        CHECK(level_type.name_to_value<level>("trace") == level::trace);
+        CHECK(level_type.name_to_value<level>("warning") == level::warning);
+        CHECK_FALSE(level_type.name_to_value<level>("fatal"));
+        CHECK_FALSE(level_type.name_to_value<mask>("trace"));
+
+        CHECK(mask_type.name_to_value<mask>("high") == mask::high);
+    }
+
+    SUBCASE("value_to_evalue") {
+        CHECK(level_type.value_to_evalue(level::trace) == level_type.name_to_evalue("trace"));
+        CHECK(level_type.value_to_evalue(meta::uvalue{level::error}) == level_type.name_to_evalue("error"));
+        CHECK(mask_type.value_to_evalue(mask::high) == mask_type.name_to_evalue("high"));
+        CHECK_FALSE(mask_type.value_to_evalue(mask{2}));
+    }
+
+    SUBCASE("rebinding") {
+        meta::enum_<level>()
+            .evalue_("info", level::error)
+            .evalue_("verbose", level::trace);
+
+        CHECK(level_type.get_evalues().size() == 6);
+        CHECK(level_type.name_to_value<level>("info") == level::error);
+        CHECK(level_type.value_to_name(level::error) == "info");
+        CHECK(level_type.value_to_name(level::trace) == "trace");
+        CHECK(level_type.value_to_name(level::info).empty());
+        CHECK(level_type.name_to_value<level>("verbose") == level::trace);
+    }
+}
@@ -39,4 +39,33 @@ TEST_CASE("meta/meta_types/type_id") {
         CHECK_FALSE(int_id.get_hash() == float_id.get_hash());
         CHECK(int_id.get_hash() == meta::resolve_type<int>().get_id().get_hash());
     }
+
+    SUBCASE("get_index") {
+        const meta::type_id int_id = meta::resolve_type<int>().get_id();
+        const meta::type_id float_id = meta::resolve_type<float>().get_id();
+
+        REQUIRE(int_id);
+        REQUIRE(float_id);
+
+        CHECK(meta::type_id{}.get_index() == 0);
+        CHECK(meta::any_type{}.get_index() == 0);
+
+        CHECK(int_id.get_index() > 0);
+        CHECK(float_id.get_index() > 0);
+        CHECK_FALSE(int_id.get_index() == float_id.get_index());
+
+        CHECK(int_id.get_index() == meta::resolve_type<int>().get_index());
+        CHECK(int_id.get_index() == meta::any_type{meta::resolve_type<int>()}.get_index());
+    }
+
+    SUBCASE("get_index/dense") {
+        std::vector<std::size_t> indices;
+        meta::for_each_type([&indices](const meta::any_type& type) { indices.push_back(type.get_index()); });
+
+        // every registered type has its own index from one to the number of types
+        std::sort(indices.begin(), indices.end());
+        for ( std::size_t i{}; i < indices.size(); ++i ) {
+            CHECK(indices[i] == i + 1);
+        }
+    }
 }
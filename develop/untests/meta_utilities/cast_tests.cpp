@@ -85,6 +85,86 @@ namespace
     //          <-
     // D2 <- E2
 
+    struct A3 {
+        A3() = default;
+        A3(const A3&) = default;
+        virtual ~A3() = default;
+        char a{'a'};
+        META_HPP_ENABLE_POLY_INFO()
+    };
+
+    struct B3 : A3 {
+        B3() = default;
+        B3(const B3&) = default;
+        char b{'b'};
+        META_HPP_ENABLE_POLY_INFO(A3)
+    };
+
+    struct C3 : B3 {
+        C3() = default;
+        C3(const C3&) = default;
+        char c{'c'};
+        META_HPP_ENABLE_POLY_INFO(B3)
+    };
+
+    struct D3 : B3 {
+        D3() = default;
+        D3(const D3&) = default;
+        char d{'d'};
+        META_HPP_ENABLE_POLY_INFO(B3)
+    };
+
+    struct E3 : C3, D3 {
+        E3() = default;
+        E3(const E3&) = default;
+        char e{'e'};
+        META_HPP_ENABLE_POLY_INFO(C3, D3)
+    };
+
+    // A3 <- B3 <- C3
+    //                <- E3
+    // A3 <- B3 <- D3
+
+    struct A4 {
+        A4() = default;
+        A4(const A4&) = default;
+        virtual ~A4() = default;
+        char a{'a'};
+        META_HPP_ENABLE_POLY_INFO()
+    };
+
+    struct B4 : virtual A4 {
+        B4() = default;
+        B4(const B4&) = default;
+        char b{'b'};
+        META_HPP_ENABLE_POLY_INFO(A4)
+    };
+
+    struct C4 : B4 {
+        C4() = default;
+        C4(const C4&) = default;
+        char c{'c'};
+        META_HPP_ENABLE_POLY_INFO(B4)
+    };
+
+    struct D4 : B4 {
+        D4() = default;
+        D4(const D4&) = default;
+        char d{'d'};
+        META_HPP_ENABLE_POLY_INFO(B4)
+    };
+
+    struct E4 : C4, D4 {
+        E4() = default;
+        E4(const E4&) = default;
+        char e{'e'};
+        META_HPP_ENABLE_POLY_INFO(C4, D4)
+    };
+
+    // A4 <= B4 <- C4
+    //                <- E4
+    // A4 <= B4 <- D4
+
     namespace meta = meta_hpp;
 
     template < meta::detail::class_kind From, meta::detail::class_kind To, typename Value >
@@ -436,3 +516,78 @@ TEST_CASE("meta/meta_utilities/ucast") {
     }
 #endif
 }
+
+TEST_CASE("meta/meta_utilities/ucast/ambiguous") {
+    namespace meta = meta_hpp;
+
+    SUBCASE("down-cast to an ambiguous class") {
+        E3 e;
+
+        C3* c = &e;
+        D3* d = &e;
+
+        B3* cb = c;
+        B3* db = d;
+
+        A3* ca = cb;
+        A3* da = db;
+
+        // alternates the source subobjects to check cached results
+        for ( int i = 0; i < 3; ++i ) {
+            CHECK(meta::ucast<B3*>(ca) == cb);
+            CHECK(meta::ucast<B3*>(da) == db);
+            CHECK(meta::ucast<const B3*>(std::as_const(ca)) == cb);
+            CHECK(meta::ucast<const B3*>(std::as_const(da)) == db);
+
+            CHECK(&meta::ucast<B3&>(*ca) == cb);
+            CHECK(&meta::ucast<B3&>(*da) == db);
+
+            CHECK(meta::ucast<A3*>(cb) == ca);
+            CHECK(meta::ucast<A3*>(db) == da);
+        }
+
+        CHECK(meta::ucast<B3*>(ca)->b == 'b');
+        CHECK(meta::ucast<B3*>(da)->b == 'b');
+    }
+
+    SUBCASE("cross-cast from an ambiguous class") {
+        E3 e;
+
+        A3* ca = static_cast<C3*>(&e);
+        A3* da = static_cast<D3*>(&e);
+
+        CHECK(meta::ucast<C3*>(ca) == static_cast<C3*>(&e));
+        CHECK(meta::ucast<C3*>(da) == static_cast<C3*>(&e));
+        CHECK(meta::ucast<D3*>(ca) == static_cast<D3*>(&e));
+        CHECK(meta::ucast<D3*>(da) == static_cast<D3*>(&e));
+        CHECK(meta::ucast<E3*>(ca) == &e);
+        CHECK(meta::ucast<E3*>(da) == &e);
+        CHECK(meta::ucast<void*>(ca) == &e);
+        CHECK(meta::ucast<void*>(da) == &e);
+
+#if !defined(META_HPP_NO_RTTI)
+        CHECK(meta::ucast<B3*>(ca) == dynamic_cast<B3*>(ca));
+        CHECK(meta::ucast<B3*>(da) == dynamic_cast<B3*>(da));
+        CHECK(meta::ucast<C3*>(da) == dynamic_cast<C3*>(da));
+        CHECK(meta::ucast<D3*>(ca) == dynamic_cast<D3*>(ca));
+#endif
+    }
+
+    SUBCASE("down-cast to an ambiguous class from a shared virtual base") {
+        E4 e;
+
+        A4* a = &e;
+
+        CHECK_FALSE(meta::ucast<B4*>(a));
+        CHECK_THROWS(std::ignore = meta::ucast<B4&>(*a));
+
+        CHECK(meta::ucast<C4*>(a) == static_cast<C4*>(&e));
+        CHECK(meta::ucast<D4*>(a) == static_cast<D4*>(&e));
+        CHECK(meta::ucast<E4*>(a) == &e);
+
+#if !defined(META_HPP_NO_RTTI)
+        CHECK(meta::ucast<B4*>(a) == dynamic_cast<B4*>(a));
+        CHECK(meta::ucast<C4*>(a) == dynamic_cast<C4*>(a));
+#endif
+    }
+}
@@ -0,0 +1,195 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+namespace
+{
+    struct A {
+        int a{1};
+        virtual ~A() = default;
+        [[nodiscard]] int get_a() const { return a; }
+        META_HPP_ENABLE_POLY_INFO()
+    };
+
+    struct B : virtual A {
+        int b{2};
+        [[nodiscard]] int get_b() const { return b; }
+        META_HPP_ENABLE_POLY_INFO(A)
+    };
+
+    struct C : virtual A {
+        int c{3};
+        META_HPP_ENABLE_POLY_INFO(A)
+    };
+
+    struct D : B, C {
+        int d{4};
+        META_HPP_ENABLE_POLY_INFO(B, C)
+    };
+
+    int sum_refs(const A& a, const B& b) {
+        return a.a + b.b;
+    }
+
+    int sum_ptrs(const A* a, const B* b) {
+        return a->a + b->b;
+    }
+
+    int sum_values(int l, int r) {
+        return l + r;
+    }
+
+    int first_b(const B* bs) {
+        return bs[0].b;
+    }
+
+    std::string move_string(std::string&& s) {
+        return std::move(s);
+    }
+}
+
+TEST_CASE("meta/meta_utilities/plan/_") {
+    namespace meta = meta_hpp;
+
+    meta::class_<A>()
+        .method_("get_a", &A::get_a);
+
+    meta::class_<B>()
+        .method_("get_b", &B::get_b);
+
+    meta::class_<C>();
+    meta::class_<D>();
+}
+
+TEST_CASE("meta/meta_utilities/plan/function") {
+    namespace meta = meta_hpp;
+
+    const meta::scope plan_scope = meta::local_scope_("plan_scope")
+        .function_("sum_refs", &sum_refs)
+        .function_("sum_ptrs", &sum_ptrs)
+        .function_("sum_values", &sum_values)
+        .function_("first_b", &first_b)
+        .function_("move_string", &move_string);
+
+    SUBCASE("invalid") {
+        {
+            const meta::function_plan<int, int> plan;
+            CHECK_FALSE(plan);
+            CHECK_FALSE(plan.is_valid());
+            CHECK_FALSE(plan.get_error());
+        }
+        {
+            const meta::function_plan<int> plan{plan_scope.get_function("sum_values")};
+            CHECK_FALSE(plan);
+            CHECK(plan.get_error() == meta::uerror{meta::error_code::arity_mismatch});
+        }
+        {
+            const meta::function_plan<const A&, const A&> plan{plan_scope.get_function("sum_refs")};
+            CHECK_FALSE(plan);
+            CHECK(plan.get_error() == meta::uerror{meta::error_code::argument_type_mismatch});
+        }
+    }
+
+    SUBCASE("values") {
+        const meta::function_plan<int, const int&> plan{plan_scope.get_function("sum_values")};
+        REQUIRE(plan);
+        CHECK(plan.get_function() == plan_scope.get_function("sum_values"));
+
+        const int r{20};
+        CHECK(plan(1, r).as<int>() == 21);
+        CHECK(plan.invoke(2, r).as<int>() == 22);
+    }
+
+    SUBCASE("references") {
+        const meta::function_plan<const D&, D&> plan{plan_scope.get_function("sum_refs")};
+        REQUIRE(plan);
+
+        D d1;
+        D d2;
+        d1.a = 10;
+        d2.b = 20;
+        CHECK(plan(d1, d2).as<int>() == 30);
+        CHECK(plan(d2, d1).as<int>() == 3);
+    }
+
+    SUBCASE("pointers") {
+        const meta::function_plan<const D*, D*> plan{plan_scope.get_function("sum_ptrs")};
+        REQUIRE(plan);
+
+        D d1;
+        D d2;
+        d1.a = 10;
+        d2.b = 20;
+        CHECK(plan(&d1, &d2).as<int>() == 30);
+        CHECK(plan(&d2, &d1).as<int>() == 3);
+    }
+
+    SUBCASE("arrays") {
+        const meta::function_plan<D(&)[2]> plan{plan_scope.get_function("first_b")};
+        REQUIRE(plan);
+
+        D ds[2];
+        ds[0].b = 10;
+        CHECK(plan(ds).as<int>() == 10);
+    }
+
+    SUBCASE("rvalues") {
+        const meta::function_plan<std::string> plan{plan_scope.get_function("move_string")};
+        REQUIRE(plan);
+
+        std::string s{"hello"};
+        CHECK(plan(std::move(s)).as<std::string>() == "hello");
+
+        CHECK_FALSE(meta::function_plan<std::string&>{plan_scope.get_function("move_string")});
+    }
+}
+
+TEST_CASE("meta/meta_utilities/plan/method") {
+    namespace meta = meta_hpp;
+
+    const meta::class_type a_type = meta::resolve_type<A>();
+    const meta::class_type b_type = meta::resolve_type<B>();
+    REQUIRE((a_type && b_type));
+
+    SUBCASE("invalid") {
+        const meta::method_plan<const A&> plan{b_type.get_method("get_b")};
+        CHECK_FALSE(plan);
+        CHECK(plan.get_error() == meta::uerror{meta::error_code::instance_type_mismatch});
+    }
+
+    SUBCASE("objects") {
+        const meta::method_plan<const D&> plan{a_type.get_method("get_a")};
+        REQUIRE(plan);
+        CHECK(plan.get_method() == a_type.get_method("get_a"));
+
+        D d1;
+        D d2;
+        d1.a = 10;
+        d2.a = 20;
+        CHECK(plan(d1).as<int>() == 10);
+        CHECK(plan(d2).as<int>() == 20);
+    }
+
+    SUBCASE("pointers") {
+        const meta::method_plan<D*> plan{b_type.get_method("get_b")};
+        REQUIRE(plan);
+
+        D d;
+        d.b = 10;
+        CHECK(plan(&d).as<int>() == 10);
+    }
+
+    SUBCASE("same_class") {
+        const meta::method_plan<B&> plan{b_type.get_method("get_b")};
+        REQUIRE(plan);
+
+        B b;
+        b.b = 10;
+        CHECK(plan(b).as<int>() == 10);
+    }
+}
@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+namespace
+{
+    struct ivec2 {
+        int x{};
+        int y{};
+
+        [[nodiscard]] int dot(const ivec2& o) const noexcept {
+            return x * o.x + y * o.y;
+        }
+
+        ivec2& scale(int s) & {
+            x *= s;
+            y *= s;
+            return *this;
+        }
+
+        [[nodiscard]] int take_x() && {
+            return x;
+        }
+    };
+
+    int sum(int l, int r) {
+        return l + r;
+    }
+
+    int negate(int v) noexcept {
+        return -v;
+    }
+
+    std::string concat(const std::string& l, std::string&& r) {
+        return l + r;
+    }
+}
+
+TEST_CASE("meta/meta_utilities/typed/_") {
+    namespace meta = meta_hpp;
+
+    meta::class_<ivec2>()
+        .method_("dot", &ivec2::dot)
+        .method_("scale", &ivec2::scale)
+        .method_("take_x", &ivec2::take_x);
+}
+
+TEST_CASE("meta/meta_utilities/typed/function") {
+    namespace meta = meta_hpp;
+
+    const meta::scope typed_scope = meta::local_scope_("typed_scope")
+        .function_("sum", &sum)
+        .function_("negate", &negate)
+        .function_("concat", &concat);
+
+    SUBCASE("invalid") {
+        CHECK_FALSE(meta::typed_function<int(int)>{});
+        CHECK_FALSE(meta::function{}.as_typed<int(int)>());
+        CHECK_FALSE(typed_scope.get_function("sum").as_typed<int(int)>());
+        CHECK_FALSE(typed_scope.get_function("sum").as_typed<int(int, float)>());
+        CHECK_FALSE(typed_scope.get_function("sum").as_typed<float(int, int)>());
+        CHECK_FALSE(typed_scope.get_function("sum").as_typed<int(int&, int)>());
+    }
+
+    SUBCASE("values") {
+        const meta::typed_function<int(int, int)> typed = typed_scope.get_function("sum").as_typed<int(int, int)>();
+        REQUIRE(typed);
+        CHECK(typed.get_pointer() == &sum);
+        CHECK(typed(1, 2) == 3);
+        CHECK(typed.invoke(3, 4) == 7);
+    }
+
+    SUBCASE("noexcept") {
+        const meta::typed_function<int(int)> typed = typed_scope.get_function("negate").as_typed<int(int)>();
+        REQUIRE(typed);
+        CHECK(typed(5) == -5);
+    }
+
+    SUBCASE("references") {
+        const auto typed = typed_scope.get_function("concat").as_typed<std::string(const std::string&, std::string&&)>();
+        REQUIRE(typed);
+
+        const std::string l{"hello"};
+        CHECK(typed(l, std::string{"world"}) == "helloworld");
+    }
+}
+
+TEST_CASE("meta/meta_utilities/typed/method") {
+    namespace meta = meta_hpp;
+
+    const meta::class_type ivec2_type = meta::resolve_type<ivec2>();
+    REQUIRE(ivec2_type);
+
+    SUBCASE("invalid") {
+        CHECK_FALSE(meta::typed_method<int(const ivec2&, const ivec2&)>{});
+        CHECK_FALSE(meta::method{}.as_typed<int(const ivec2&, const ivec2&)>());
+        CHECK_FALSE(ivec2_type.get_method("dot").as_typed<int(const ivec2&, ivec2)>());
+        CHECK_FALSE(ivec2_type.get_method("dot").as_typed<float(const ivec2&, const ivec2&)>());
+        CHECK_FALSE(ivec2_type.get_method("scale").as_typed<ivec2&(const ivec2&, int)>());
+        CHECK_FALSE(ivec2_type.get_method("scale").as_typed<ivec2&(ivec2&&, int)>());
+        CHECK_FALSE(ivec2_type.get_method("take_x").as_typed<int(ivec2&)>());
+    }
+
+    SUBCASE("const") {
+        const auto typed = ivec2_type.get_method("dot").as_typed<int(const ivec2&, const ivec2&)>();
+        REQUIRE(typed);
+
+        const ivec2 v{1, 2};
+        CHECK(typed(v, ivec2{3, 4}) == 11);
+
+        const auto mutable_typed = ivec2_type.get_method("dot").as_typed<int(ivec2&, const ivec2&)>();
+        REQUIRE(mutable_typed);
+
+        ivec2 w{2, 3};
+        CHECK(mutable_typed(w, ivec2{1, 1}) == 5);
+    }
+
+    SUBCASE("lvalue") {
+        const auto typed = ivec2_type.get_method("scale").as_typed<ivec2&(ivec2&, int)>();
+        REQUIRE(typed);
+
+        ivec2 v{1, 2};
+        CHECK(&typed(v, 3) == &v);
+        CHECK(v.x == 3);
+        CHECK(v.y == 6);
+    }
+
+    SUBCASE("rvalue") {
+        const auto typed = ivec2_type.get_method("take_x").as_typed<int(ivec2&&)>();
+        REQUIRE(typed);
+        CHECK(typed(ivec2{42, 0}) == 42);
+    }
+}
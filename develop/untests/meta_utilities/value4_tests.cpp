@@ -259,3 +259,38 @@ TEST_CASE("meta/meta_utilities/value4/emplace") {
         CHECK(clazz_throw_dtor::copy_constructor_counter == 2);
     }
 }
+
+TEST_CASE("meta/meta_utilities/value4/inline_storage") {
+    namespace meta = meta_hpp;
+
+    struct inline_value {
+        // NOLINTNEXTLINE(*-avoid-c-arrays)
+        std::byte data[META_HPP_UVALUE_INLINE_SIZE];
+    };
+
+    struct external_value {
+        // NOLINTNEXTLINE(*-avoid-c-arrays)
+        std::byte data[sizeof(meta_hpp::uvalue)];
+    };
+
+    static_assert(sizeof(meta::uvalue) >= META_HPP_UVALUE_INLINE_SIZE + sizeof(void*));
+    static_assert(alignof(meta::uvalue) == META_HPP_UVALUE_INLINE_ALIGN);
+
+    SUBCASE("inline") {
+        meta::uvalue v{inline_value{}};
+        const void* data = v.get_data();
+
+        // inline values are moved with their owner
+        meta::uvalue v2{std::move(v)};
+        CHECK(v2.get_data() != data);
+    }
+
+    SUBCASE("external") {
+        meta::uvalue v{external_value{}};
+        const void* data = v.get_data();
+
+        // external values stay where they were allocated
+        meta::uvalue v2{std::move(v)};
+        CHECK(v2.get_data() == data);
+    }
+}
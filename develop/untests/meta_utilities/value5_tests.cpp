@@ -0,0 +1,213 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+namespace
+{
+    namespace meta = meta_hpp;
+
+    class counting_resource final : public meta::uvalue_memory_resource {
+    public:
+        std::size_t allocations{};
+        std::size_t deallocations{};
+
+    protected:
+        void* do_allocate(std::size_t size, std::size_t align) override {
+            ++allocations;
+            return pool_.allocate(size, align);
+        }
+
+        void do_deallocate(void* ptr, std::size_t size, std::size_t align) noexcept override {
+            ++deallocations;
+            pool_.deallocate(ptr, size, align);
+        }
+
+    private:
+        meta::uvalue_pool_resource pool_;
+    };
+
+    class scoped_thread_resource final {
+    public:
+        explicit scoped_thread_resource(meta::uvalue_memory_resource* resource)
+        : prev_{meta::set_thread_uvalue_resource(resource)} {}
+
+        ~scoped_thread_resource() {
+            meta::set_thread_uvalue_resource(prev_);
+        }
+
+        scoped_thread_resource(const scoped_thread_resource&) = delete;
+        scoped_thread_resource& operator=(const scoped_thread_resource&) = delete;
+
+    private:
+        meta::uvalue_memory_resource* prev_{};
+    };
+
+    struct big_value {
+        // NOLINTNEXTLINE(*-avoid-c-arrays)
+        int data[64]{};
+    };
+
+    struct alignas(64) aligned_value {
+        int data{};
+    };
+
+    struct throw_ctor_value {
+        // NOLINTNEXTLINE(*-avoid-c-arrays)
+        int data[64]{};
+
+        throw_ctor_value() = default;
+
+        throw_ctor_value(int) {
+            meta::detail::throw_exception(meta::error_code::bad_uvalue_operation);
+        }
+    };
+}
+
+TEST_CASE("meta/meta_utilities/value5/resource") {
+    SUBCASE("default") {
+        CHECK(meta::get_uvalue_resource() == nullptr);
+
+        meta::uvalue v{big_value{}};
+        CHECK(v.as<big_value>().data[0] == 0);
+    }
+
+    SUBCASE("thread") {
+        counting_resource resource;
+
+        {
+            const scoped_thread_resource scope{&resource};
+            CHECK(meta::get_uvalue_resource() == &resource);
+
+            meta::uvalue v1{big_value{}};
+            CHECK(resource.allocations == 1);
+
+            // inline values don't need the resource
+            meta::uvalue v2{42};
+            CHECK(resource.allocations == 1);
+
+            // moves keep the same allocation
+            meta::uvalue v3{std::move(v1)};
+            CHECK(resource.allocations == 1);
+            CHECK(resource.deallocations == 0);
+
+            v3.reset();
+            CHECK(resource.deallocations == 1);
+        }
+
+        CHECK(meta::get_uvalue_resource() == nullptr);
+    }
+
+    SUBCASE("global") {
+        counting_resource global_resource;
+        counting_resource thread_resource;
+
+        CHECK(meta::set_uvalue_resource(&global_resource) == nullptr);
+        CHECK(meta::get_uvalue_resource() == &global_resource);
+
+        {
+            meta::uvalue v1{big_value{}};
+            CHECK(global_resource.allocations == 1);
+
+            // the thread resource takes precedence over the global one
+            const scoped_thread_resource scope{&thread_resource};
+            meta::uvalue v2{big_value{}};
+            CHECK(global_resource.allocations == 1);
+            CHECK(thread_resource.allocations == 1);
+        }
+
+        CHECK(global_resource.deallocations == 1);
+        CHECK(thread_resource.deallocations == 1);
+
+        CHECK(meta::set_uvalue_resource(nullptr) == &global_resource);
+    }
+
+    SUBCASE("owner") {
+        counting_resource resource;
+        meta::uvalue v;
+
+        {
+            const scoped_thread_resource scope{&resource};
+            v = big_value{};
+        }
+
+        // values are returned to the resource they were allocated by
+        v.reset();
+        CHECK(resource.allocations == 1);
+        CHECK(resource.deallocations == 1);
+    }
+
+    SUBCASE("aligned") {
+        counting_resource resource;
+        const scoped_thread_resource scope{&resource};
+
+        meta::uvalue v{aligned_value{42}};
+        CHECK(resource.allocations == 1);
+        CHECK(reinterpret_cast<std::uintptr_t>(v.get_data()) % alignof(aligned_value) == 0);
+        CHECK(v.as<aligned_value>().data == 42);
+    }
+
+#if !defined(META_HPP_NO_EXCEPTIONS)
+    SUBCASE("throw_ctor") {
+        counting_resource resource;
+        const scoped_thread_resource scope{&resource};
+
+        CHECK_THROWS(meta::uvalue{std::in_place_type<throw_ctor_value>, 42});
+        CHECK(resource.allocations == 1);
+        CHECK(resource.deallocations == 1);
+    }
+#endif
+}
+
+TEST_CASE("meta/meta_utilities/value5/pool_resource") {
+    meta::uvalue_pool_resource pool;
+
+    SUBCASE("reuse") {
+        void* ptr1 = pool.allocate(24, 8);
+        void* ptr2 = pool.allocate(24, 8);
+        CHECK(ptr1 != ptr2);
+
+        pool.deallocate(ptr1, 24, 8);
+        CHECK(pool.allocate(32, 16) == ptr1);
+
+        pool.deallocate(ptr1, 32, 16);
+        pool.deallocate(ptr2, 24, 8);
+    }
+
+    SUBCASE("size_classes") {
+        for ( std::size_t size{1}; size <= meta::uvalue_pool_resource::max_block_size * 2; size *= 2 ) {
+            std::vector<void*> blocks;
+
+            for ( std::size_t i{}; i < meta::uvalue_pool_resource::blocks_per_chunk * 2; ++i ) {
+                void* ptr = pool.allocate(size, alignof(std::max_align_t));
+                CHECK(reinterpret_cast<std::uintptr_t>(ptr) % alignof(std::max_align_t) == 0);
+                std::memset(ptr, 0xAB, size);
+                blocks.push_back(ptr);
+            }
+
+            std::sort(blocks.begin(), blocks.end());
+            CHECK(std::adjacent_find(blocks.begin(), blocks.end()) == blocks.end());
+
+            for ( void* ptr : blocks ) {
+                pool.deallocate(ptr, size, alignof(std::max_align_t));
+            }
+        }
+    }
+
+    SUBCASE("uvalue") {
+        const scoped_thread_resource scope{&pool};
+
+        const void* data{};
+        {
+            meta::uvalue v{big_value{}};
+            data = v.get_data();
+        }
+
+        meta::uvalue v{big_value{}};
+        CHECK(v.get_data() == data);
+    }
+}
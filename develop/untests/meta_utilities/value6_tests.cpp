@@ -0,0 +1,379 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+#include <thread>
+
+namespace
+{
+    struct config {
+        // NOLINTNEXTLINE(*-avoid-c-arrays)
+        int data[32]{};
+
+        config() = default;
+        explicit config(int v) : data{v} {}
+
+        config(config&& other) noexcept {
+            std::copy(std::begin(other.data), std::end(other.data), std::begin(data));
+            ++move_constructor_counter;
+        }
+
+        config(const config& other) {
+            std::copy(std::begin(other.data), std::end(other.data), std::begin(data));
+            ++copy_constructor_counter;
+        }
+
+        config& operator=(config&&) = default;
+        config& operator=(const config&) = default;
+
+        ~config() {
+            ++destructor_counter;
+        }
+
+        [[nodiscard]] int get() const {
+            return data[0];
+        }
+
+        void set(int v) {
+            data[0] = v;
+        }
+
+        static int read(const config& c) {
+            return c.data[0];
+        }
+
+        static void write(config& c, int v) {
+            c.data[0] = v;
+        }
+
+        friend bool operator<(const config& l, const config& r) {
+            return l.data[0] < r.data[0];
+        }
+
+        friend bool operator==(const config& l, const config& r) {
+            return l.data[0] == r.data[0];
+        }
+
+        inline static int destructor_counter{};
+        inline static int move_constructor_counter{};
+        inline static int copy_constructor_counter{};
+    };
+
+    struct not_copyable {
+        int data{};
+    };
+
+    class counting_resource final : public meta_hpp::uvalue_memory_resource {
+    public:
+        std::size_t allocations{};
+        std::size_t deallocations{};
+
+    protected:
+        void* do_allocate(std::size_t size, std::size_t align) override {
+            ++allocations;
+            return pool_.allocate(size, align);
+        }
+
+        void do_deallocate(void* ptr, std::size_t size, std::size_t align) noexcept override {
+            ++deallocations;
+            pool_.deallocate(ptr, size, align);
+        }
+
+    private:
+        meta_hpp::uvalue_pool_resource pool_;
+    };
+}
+
+META_HPP_DECLARE_COPY_TRAITS_FOR(config)
+META_HPP_DECLARE_LESS_TRAITS_FOR(config)
+META_HPP_DECLARE_EQUALS_TRAITS_FOR(config)
+
+TEST_CASE("meta/meta_utilities/value6") {
+    namespace meta = meta_hpp;
+
+    meta::class_<config>()
+        .method_("get", &config::get)
+        .method_("set", &config::set)
+        .function_("read", &config::read)
+        .function_("write", &config::write);
+}
+
+TEST_CASE("meta/meta_utilities/value6/shared") {
+    namespace meta = meta_hpp;
+
+    config::destructor_counter = 0;
+    config::move_constructor_counter = 0;
+    config::copy_constructor_counter = 0;
+
+    SUBCASE("make_shared_uvalue") {
+        {
+            const meta::uvalue v = meta::make_shared_uvalue<config>(42);
+            CHECK(v.is_shared());
+            CHECK(v.get_type() == meta::resolve_type<config>());
+            CHECK(v.as<config>().get() == 42);
+
+            CHECK(meta::make_shared_uvalue<std::vector<int>>({1, 2, 3}).as<std::vector<int>>().size() == 3);
+            CHECK(config::move_constructor_counter == 0);
+            CHECK(config::copy_constructor_counter == 0);
+        }
+        CHECK(config::destructor_counter == 1);
+
+        CHECK_FALSE(meta::uvalue{42}.is_shared());
+        CHECK_FALSE(meta::uvalue{}.is_shared());
+    }
+
+    SUBCASE("copy") {
+        meta::uvalue v1 = meta::make_shared_uvalue<config>(42);
+
+        {
+            std::vector<meta::uvalue> subscribers;
+            for ( std::size_t i{}; i < 50; ++i ) {
+                subscribers.push_back(v1.copy());
+            }
+
+            for ( const meta::uvalue& v : subscribers ) {
+                CHECK(v.is_shared());
+                CHECK(v.get_cdata() == v1.get_cdata());
+            }
+
+            CHECK(config::copy_constructor_counter == 0);
+        }
+
+        v1.reset();
+        CHECK(config::destructor_counter == 1);
+    }
+
+    SUBCASE("share") {
+        meta::uvalue v1{config{42}};
+        CHECK_FALSE(v1.is_shared());
+        config::move_constructor_counter = 0;
+
+        // a unique value is moved to the shared storage once
+        meta::uvalue v2 = v1.share();
+        CHECK(v1.is_shared());
+        CHECK(v2.is_shared());
+        CHECK(v1.get_cdata() == v2.get_cdata());
+        CHECK(config::move_constructor_counter == 1);
+
+        meta::uvalue v3 = v2.share();
+        CHECK(v3.get_cdata() == v1.get_cdata());
+        CHECK(config::move_constructor_counter == 1);
+        CHECK(config::copy_constructor_counter == 0);
+
+        CHECK_FALSE(meta::uvalue{}.share());
+    }
+
+    SUBCASE("copy_on_write") {
+        meta::uvalue v1 = meta::make_shared_uvalue<config>(42);
+        meta::uvalue v2 = v1.copy();
+
+        v2.as<config>().set(21);
+        CHECK_FALSE(v2.is_shared());
+        CHECK(v2.get_cdata() != v1.get_cdata());
+        CHECK(config::copy_constructor_counter == 1);
+
+        CHECK(v1.is_shared());
+        CHECK(v1.as<config>().get() == 42);
+        CHECK(v2.as<config>().get() == 21);
+
+        // the last owner takes the value without copying
+        v1.as<config>().set(84);
+        CHECK_FALSE(v1.is_shared());
+        CHECK(config::copy_constructor_counter == 1);
+        CHECK(config::move_constructor_counter == 1);
+        CHECK(v1.as<config>().get() == 84);
+    }
+
+    SUBCASE("as/try_as") {
+        meta::uvalue v1 = meta::make_shared_uvalue<config>(42);
+        const meta::uvalue v2 = v1.copy();
+
+        // the type is checked before detaching
+        CHECK(v1.try_as<int>() == nullptr);
+        CHECK_THROWS(std::ignore = v1.as<int>());
+        CHECK(v1.is_shared());
+        CHECK(config::copy_constructor_counter == 0);
+
+        // try_as doesn't detach, shared values are constant for it
+        CHECK(v1.try_as<config>() == nullptr);
+        CHECK(std::as_const(v1).try_as<config>() == v2.get_data());
+        CHECK(v1.is_shared());
+
+        config* ptr{&v1.as<config>()};
+        CHECK_FALSE(v1.is_shared());
+        CHECK(ptr == v1.try_as<config>());
+        CHECK(ptr != v2.get_data());
+        CHECK(config::copy_constructor_counter == 1);
+
+        meta::uvalue v3 = v2.copy();
+        CHECK(std::move(v3).as<config>().get() == 42);
+        CHECK(config::copy_constructor_counter == 2);
+    }
+
+    SUBCASE("get_data") {
+        meta::uvalue v1 = meta::make_shared_uvalue<config>(42);
+        const meta::uvalue v2 = v1.copy();
+
+        CHECK(v1.get_data() == v2.get_data());
+        CHECK(v1.get_cdata() == v2.get_data());
+        CHECK(v1.is_shared());
+
+        void* data{v1.get_mutable_data()};
+        CHECK(data != nullptr);
+        CHECK(data != v2.get_data());
+        CHECK(data == v1.get_data());
+        CHECK_FALSE(v1.is_shared());
+        CHECK(config::copy_constructor_counter == 1);
+    }
+
+    SUBCASE("unshare") {
+        meta::uvalue v1 = meta::make_shared_uvalue<config>(42);
+        meta::uvalue v2 = v1.copy();
+
+        v1.unshare();
+        CHECK_FALSE(v1.is_shared());
+        CHECK(v2.is_shared());
+        CHECK(v1.get_cdata() != v2.get_cdata());
+        CHECK(v1.equals(v2));
+
+        v1.unshare();
+        CHECK(config::copy_constructor_counter == 1);
+    }
+
+    SUBCASE("compare") {
+        const meta::uvalue v1 = meta::make_shared_uvalue<config>(42);
+        const meta::uvalue v2{config{42}};
+        const meta::uvalue v3{config{84}};
+
+        CHECK(v1.equals(v2));
+        CHECK(v2.equals(v1));
+        CHECK_FALSE(v1.equals(v3));
+
+        CHECK(v1.less(v3));
+        CHECK_FALSE(v3.less(v1));
+        CHECK_FALSE(v1.less(v2));
+        CHECK_FALSE(v2.less(v1));
+
+        // shared values are ordered by the storage of their type
+        CHECK(meta::make_shared_uvalue<int>(42).equals(meta::uvalue{42}));
+        CHECK(meta::uvalue{42}.less(meta::make_shared_uvalue<int>(84)));
+    }
+
+    SUBCASE("invoke") {
+        const meta::class_type config_type = meta::resolve_type<config>();
+        const meta::function read = config_type.get_function("read");
+        const meta::function write = config_type.get_function("write");
+        const meta::method get = config_type.get_method("get");
+        const meta::method set = config_type.get_method("set");
+        REQUIRE((read && write && get && set));
+
+        meta::uvalue v1 = meta::make_shared_uvalue<config>(42);
+        meta::uvalue v2 = v1.copy();
+
+        // shared values are passed as constant ones
+        CHECK(read.invoke(v1).as<int>() == 42);
+        CHECK(get.invoke(v1).as<int>() == 42);
+        CHECK_FALSE(write.try_invoke(v1, 21));
+        CHECK_FALSE(set.try_invoke(v1, 21));
+        CHECK(v1.is_shared());
+        CHECK(config::copy_constructor_counter == 0);
+
+        CHECK(meta::uvalue_ref{v1}.is_ref_const());
+        CHECK(meta::uvalue_ref{v1}.get_data() == nullptr);
+        CHECK(std::as_const(v1).try_as<config>() != nullptr);
+
+        v1.unshare();
+        CHECK(write.try_invoke(v1, 21));
+        CHECK(v1.as<config>().get() == 21);
+        CHECK(v2.as<config>().get() == 42);
+    }
+
+    SUBCASE("assign") {
+        meta::uvalue v1 = meta::make_shared_uvalue<config>(42);
+        const meta::uvalue v2 = v1.copy();
+
+        v1.assign(config{21});
+        CHECK_FALSE(v1.is_shared());
+        CHECK(v1.as<config>().get() == 21);
+        CHECK(v2.as<config>().get() == 42);
+
+        meta::uvalue v3 = v2.copy();
+        v3 = 42;
+        CHECK(v3.as<int>() == 42);
+        CHECK(v2.as<config>().get() == 42);
+    }
+
+    SUBCASE("move/swap") {
+        meta::uvalue v1 = meta::make_shared_uvalue<config>(42);
+        const void* data = v1.get_cdata();
+
+        meta::uvalue v2{std::move(v1)};
+        CHECK(v2.is_shared());
+        CHECK(v2.get_cdata() == data);
+
+        meta::uvalue v3{config{21}};
+        v2.swap(v3);
+        CHECK(v3.is_shared());
+        CHECK(v3.get_cdata() == data);
+        CHECK(v2.as<config>().get() == 21);
+
+        CHECK(config::copy_constructor_counter == 0);
+    }
+
+    SUBCASE("resource") {
+        counting_resource resource;
+        meta::uvalue v1;
+
+        {
+            meta::uvalue_memory_resource* prev{meta::set_thread_uvalue_resource(&resource)};
+            v1 = meta::make_shared_uvalue<int>(42);
+            meta::set_thread_uvalue_resource(prev);
+        }
+
+        meta::uvalue v2 = v1.copy();
+        CHECK(resource.allocations == 1);
+
+        v1.reset();
+        CHECK(resource.deallocations == 0);
+
+        v2.reset();
+        CHECK(resource.deallocations == 1);
+    }
+
+    SUBCASE("threads") {
+        const meta::uvalue v1 = meta::make_shared_uvalue<config>(42);
+        std::atomic<int> sum{};
+
+        std::vector<std::thread> threads;
+        for ( std::size_t i{}; i < 4; ++i ) {
+            threads.emplace_back([&v1, &sum]() {
+                for ( std::size_t j{}; j < 1000; ++j ) {
+                    const meta::uvalue v2 = v1.copy();
+                    sum += v2.as<config>().get();
+                }
+            });
+        }
+
+        for ( std::thread& thread : threads ) {
+            thread.join();
+        }
+
+        CHECK(sum == 4 * 1000 * 42);
+        CHECK(config::copy_constructor_counter == 0);
+        CHECK(config::destructor_counter == 0);
+    }
+
+#if !defined(META_HPP_NO_EXCEPTIONS)
+    SUBCASE("not_copyable") {
+        meta::uvalue v{not_copyable{42}};
+        CHECK_THROWS_AS(std::ignore = v.share(), meta::exception);
+        CHECK_FALSE(v.is_shared());
+        CHECK(v.as<not_copyable>().data == 42);
+    }
+#endif
+}
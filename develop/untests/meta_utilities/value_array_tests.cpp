@@ -0,0 +1,288 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+namespace
+{
+    struct ivec2 {
+        int x{};
+        int y{};
+
+        ivec2() = default;
+        ivec2(int nx, int ny) : x{nx}, y{ny} {}
+
+        [[nodiscard]] int length2() const {
+            return x * x + y * y;
+        }
+
+        friend bool operator<(const ivec2& l, const ivec2& r) {
+            return std::tie(l.x, l.y) < std::tie(r.x, r.y);
+        }
+
+        friend bool operator==(const ivec2& l, const ivec2& r) {
+            return l.x == r.x && l.y == r.y;
+        }
+    };
+
+    struct label {
+        std::string name;
+    };
+}
+
+META_HPP_DECLARE_COPY_TRAITS_FOR(ivec2)
+META_HPP_DECLARE_LESS_TRAITS_FOR(ivec2)
+META_HPP_DECLARE_EQUALS_TRAITS_FOR(ivec2)
+
+TEST_CASE("meta/meta_utilities/value_array/_") {
+    namespace meta = meta_hpp;
+
+    meta::class_<ivec2>()
+        .method_("length2", &ivec2::length2);
+}
+
+TEST_CASE("meta/meta_utilities/value_array") {
+    namespace meta = meta_hpp;
+
+    SUBCASE("ctors") {
+        const meta::uvalue_array a1;
+        CHECK(a1.is_empty());
+        CHECK(a1.get_size() == 0);
+        CHECK_FALSE(a1.get_type());
+        CHECK(a1.get_data() == nullptr);
+
+        const meta::uvalue_array a2{std::in_place_type<int>};
+        CHECK(a2.is_empty());
+        CHECK(a2.get_type() == meta::resolve_type<int>());
+    }
+
+    SUBCASE("emplace_back") {
+        meta::uvalue_array a;
+
+        for ( int i{}; i < 100; ++i ) {
+            CHECK(a.emplace_back<ivec2>(i, i * 2).x == i);
+        }
+
+        CHECK(a.get_size() == 100);
+        CHECK(a.get_capacity() >= 100);
+        CHECK(a.get_type() == meta::resolve_type<ivec2>());
+
+        const std::span<const ivec2> s = std::as_const(a).as_span<ivec2>();
+        REQUIRE(s.size() == 100);
+        CHECK(s[42].y == 84);
+        CHECK(a.get_cdata() == s.data());
+
+        // elements can be passed to the array they are from
+        a.emplace_back<ivec2>(a.as_span<ivec2>()[3]);
+        CHECK(a.as_span<ivec2>().back().y == 6);
+
+        a.pop_back();
+        CHECK(a.get_size() == 100);
+
+        a.clear();
+        CHECK(a.is_empty());
+        CHECK(a.get_type() == meta::resolve_type<ivec2>());
+
+#if !defined(META_HPP_NO_EXCEPTIONS)
+        CHECK_THROWS(a.emplace_back<int>(42));
+        CHECK_THROWS(std::ignore = a.as_span<int>());
+#endif
+    }
+
+    SUBCASE("push_back") {
+        meta::uvalue_array a{std::in_place_type<std::string>};
+
+        a.push_back(meta::uvalue{std::string{"hello"}});
+        a.push_back(meta::make_shared_uvalue<std::string>("world"));
+        REQUIRE(a.get_size() == 2);
+        CHECK(a.as_span<std::string>()[0] == "hello");
+        CHECK(a.as_span<std::string>()[1] == "world");
+
+#if !defined(META_HPP_NO_EXCEPTIONS)
+        CHECK_THROWS(a.push_back(meta::uvalue{42}));
+        CHECK_THROWS(a.push_back(meta::uvalue{}));
+        CHECK_THROWS(meta::uvalue_array{}.push_back(meta::uvalue{42}));
+#endif
+        CHECK(a.get_size() == 2);
+    }
+
+    SUBCASE("refs") {
+        meta::uvalue_array a;
+        a.emplace_back<ivec2>(3, 4);
+
+        const meta::uvalue_ref r = a[0];
+        CHECK(r.get_type() == meta::resolve_type<ivec2>());
+        CHECK(r.get_ref_type() == meta::uvalue_ref::ref_types::lvalue);
+        CHECK(r.get_data() == a.get_data());
+
+        const meta::uvalue_ref cr = std::as_const(a)[0];
+        CHECK(cr.get_ref_type() == meta::uvalue_ref::ref_types::const_lvalue);
+        CHECK(cr.get_data() == nullptr);
+
+        const meta::method length2 = meta::resolve_type<ivec2>().get_method("length2");
+        REQUIRE(length2);
+        CHECK(length2.invoke(a[0]).as<int>() == 25);
+    }
+
+    SUBCASE("move/swap") {
+        meta::uvalue_array a1;
+        a1.emplace_back<int>(42);
+        const void* data = a1.get_data();
+
+        meta::uvalue_array a2{std::move(a1)};
+        CHECK(a2.get_data() == data);
+        CHECK(a2.get_size() == 1);
+
+        meta::uvalue_array a3{std::in_place_type<float>};
+        a3.emplace_back<float>(1.f);
+        a2.swap(a3);
+        CHECK(a3.as_span<int>()[0] == 42);
+        CHECK(a2.as_span<float>()[0] == 1.f);
+
+        a2 = std::move(a3);
+        CHECK(a2.get_type() == meta::resolve_type<int>());
+    }
+
+    SUBCASE("copy") {
+        meta::uvalue_array a1;
+        a1.emplace_back<std::string>("hello");
+        a1.emplace_back<std::string>("world");
+
+        const meta::uvalue_array a2 = a1.copy();
+        CHECK(a2.get_data() != a1.get_data());
+        CHECK(a2.equals(a1));
+
+        meta::uvalue_array a3;
+        a3.emplace_back<label>();
+        CHECK_FALSE(a3.has_copy_op());
+        CHECK_FALSE(a3.has_less_op());
+        CHECK_FALSE(a3.has_equals_op());
+        CHECK_FALSE(a3.has_hash_op());
+
+#if !defined(META_HPP_NO_EXCEPTIONS)
+        CHECK_THROWS(std::ignore = a3.copy());
+        CHECK_THROWS(a3.sort());
+        CHECK_THROWS(std::ignore = a3.equals(a3.copy()));
+#endif
+    }
+
+    SUBCASE("list") {
+        meta::uvalue_list list;
+        list.emplace_back(ivec2{1, 2});
+        list.emplace_back(ivec2{3, 4});
+
+        meta::uvalue_array a{std::in_place_type<ivec2>, std::move(list)};
+        REQUIRE(a.get_size() == 2);
+        CHECK(a.as_span<ivec2>()[1].x == 3);
+
+        const meta::uvalue_list list2 = a.to_list();
+        REQUIRE(list2.size() == 2);
+        CHECK(list2[0].as<ivec2>().y == 2);
+        CHECK(a.get_size() == 2);
+
+        const meta::uvalue_list list3 = std::move(a).to_list();
+        REQUIRE(list3.size() == 2);
+        CHECK(list3[1].as<ivec2>().y == 4);
+        CHECK(a.is_empty()); // NOLINT(*-use-after-move)
+
+#if !defined(META_HPP_NO_EXCEPTIONS)
+        meta::uvalue_list list4;
+        list4.emplace_back(ivec2{1, 2});
+        list4.emplace_back(42);
+
+        CHECK_THROWS(meta::uvalue_array{std::in_place_type<ivec2>, std::move(list4)});
+        CHECK(list4[0].as<ivec2>().x == 1);
+#endif
+    }
+
+    SUBCASE("sort") {
+        meta::uvalue_array a;
+        for ( int v : {5, 3, 9, 1, 7} ) {
+            a.emplace_back<int>(v);
+        }
+
+        CHECK(a.sort_indices() == std::vector<std::size_t>{3, 1, 0, 4, 2});
+
+        a.sort();
+        const std::span<const int> s = std::as_const(a).as_span<int>();
+        CHECK(std::vector<int>(s.begin(), s.end()) == std::vector<int>{1, 3, 5, 7, 9});
+
+        meta::uvalue_array b;
+        b.emplace_back<ivec2>(1, 2);
+        b.emplace_back<ivec2>(1, 1);
+        b.emplace_back<ivec2>(1, 2);
+        CHECK(b.sort_indices() == std::vector<std::size_t>{1, 0, 2});
+    }
+
+    SUBCASE("compare") {
+        meta::uvalue_array a1;
+        meta::uvalue_array a2;
+
+        for ( int v : {1, 2, 3} ) {
+            a1.emplace_back<int>(v);
+            a2.emplace_back<int>(v);
+        }
+
+        CHECK(a1.equals(a2));
+        CHECK_FALSE(a1.less(a2));
+        CHECK_FALSE(a2.less(a1));
+
+        a2.emplace_back<int>(0);
+        CHECK_FALSE(a1.equals(a2));
+        CHECK(a1.less(a2));
+        CHECK_FALSE(a2.less(a1));
+
+        a1.as_span<int>()[2] = 4;
+        CHECK(a2.less(a1));
+
+        meta::uvalue_array a3{std::in_place_type<float>};
+        CHECK_FALSE(a1.equals(a3));
+        CHECK(a1.less(a3) != a3.less(a1));
+
+        CHECK(meta::uvalue_array{}.equals(meta::uvalue_array{}));
+        CHECK_FALSE(meta::uvalue_array{}.less(meta::uvalue_array{}));
+    }
+
+    SUBCASE("hash") {
+        meta::uvalue_array a1;
+        meta::uvalue_array a2;
+
+        for ( int v : {1, 2, 3} ) {
+            a1.emplace_back<int>(v);
+            a2.emplace_back<int>(v);
+        }
+
+        CHECK(a1.get_hash() == a2.get_hash());
+
+        a2.as_span<int>()[0] = 4;
+        CHECK(a1.get_hash() != a2.get_hash());
+
+        std::vector<std::size_t> hashes(a1.get_size());
+        a1.get_hashes(hashes);
+        CHECK(hashes[1] == std::hash<int>{}(2));
+    }
+
+    SUBCASE("resource") {
+        meta::uvalue_pool_resource pool;
+        meta::uvalue_memory_resource* prev{meta::set_thread_uvalue_resource(&pool)};
+
+        meta::uvalue_array a;
+        a.emplace_back<int>(42);
+        void* data = a.get_data();
+
+        meta::set_thread_uvalue_resource(prev);
+
+        // buffers are returned to the resource they were allocated by
+        a = meta::uvalue_array{};
+
+        meta::set_thread_uvalue_resource(&pool);
+        meta::uvalue_array b;
+        b.emplace_back<int>(42);
+        CHECK(b.get_data() == data);
+        meta::set_thread_uvalue_resource(prev);
+    }
+}
@@ -0,0 +1,259 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <meta.hpp/meta_all.hpp>
+#include <doctest/doctest.h>
+
+namespace
+{
+    struct ivec2 {
+        int x{};
+        int y{};
+
+        ivec2() = default;
+        ivec2(int nx, int ny) : x{nx}, y{ny} {}
+
+        ivec2(ivec2&& other) noexcept : x{other.x}, y{other.y} {
+            other.x = 0;
+            other.y = 0;
+            ++move_constructor_counter;
+        }
+
+        ivec2(const ivec2& other) : x{other.x}, y{other.y} {
+            ++copy_constructor_counter;
+        }
+
+        ivec2& operator=(ivec2&&) = default;
+        ivec2& operator=(const ivec2&) = default;
+
+        [[nodiscard]] int dot(const ivec2& other) const {
+            return x * other.x + y * other.y;
+        }
+
+        static int length2(const ivec2& v) {
+            return v.dot(v);
+        }
+
+        static int steal_x(ivec2&& v) {
+            const ivec2 tmp{std::move(v)};
+            return tmp.x;
+        }
+
+        static void scale(ivec2& v, int s) {
+            v.x *= s;
+            v.y *= s;
+        }
+
+        inline static int move_constructor_counter{};
+        inline static int copy_constructor_counter{};
+    };
+
+    struct holder {
+        ivec2 value{};
+        inline static ivec2 static_value{};
+    };
+}
+
+TEST_CASE("meta/meta_utilities/value_ref/_") {
+    namespace meta = meta_hpp;
+
+    meta::class_<ivec2>()
+        .constructor_<int, int>()
+        .constructor_<const ivec2&>()
+        .method_("dot", &ivec2::dot)
+        .function_("length2", &ivec2::length2)
+        .function_("steal_x", &ivec2::steal_x)
+        .function_("scale", &ivec2::scale);
+
+    meta::class_<holder>()
+        .member_("value", &holder::value)
+        .variable_("static_value", &holder::static_value);
+}
+
+TEST_CASE("meta/meta_utilities/value_ref") {
+    namespace meta = meta_hpp;
+
+    ivec2::move_constructor_counter = 0;
+    ivec2::copy_constructor_counter = 0;
+
+    SUBCASE("ctors") {
+        const meta::uvalue empty;
+        CHECK_FALSE(meta::uvalue_ref{});
+        CHECK_FALSE(meta::uvalue_ref{empty});
+
+        ivec2 v{1, 2};
+        const ivec2 cv{3, 4};
+
+        {
+            const meta::uvalue_ref r{v};
+            CHECK(r);
+            CHECK(r.get_type() == meta::resolve_type<ivec2>());
+            CHECK(r.get_ref_type() == meta::uvalue_ref::ref_types::lvalue);
+            CHECK(r.get_data() == &v);
+            CHECK(r.get_cdata() == &v);
+        }
+
+        {
+            const meta::uvalue_ref r{cv};
+            CHECK(r.get_ref_type() == meta::uvalue_ref::ref_types::const_lvalue);
+            CHECK(r.is_ref_const());
+            CHECK(r.get_data() == nullptr);
+            CHECK(r.get_cdata() == &cv);
+        }
+
+        {
+            const meta::uvalue_ref r{meta::resolve_type<ivec2>(), static_cast<void*>(&v), meta::uvalue_ref::ref_types::rvalue};
+            CHECK(r.get_ref_type() == meta::uvalue_ref::ref_types::rvalue);
+            CHECK(r.get_data() == &v);
+        }
+
+        {
+            meta::uvalue uv{ivec2{5, 6}};
+            const meta::uvalue_ref r{uv};
+            CHECK(r.get_type() == meta::resolve_type<ivec2>());
+            CHECK(r.get_ref_type() == meta::uvalue_ref::ref_types::lvalue);
+            CHECK(r.get_data() == uv.get_data());
+
+            const meta::uvalue_ref cr{std::as_const(uv)};
+            CHECK(cr.get_ref_type() == meta::uvalue_ref::ref_types::const_lvalue);
+            CHECK(cr.get_cdata() == uv.get_data());
+        }
+
+        {
+            const meta::uvalue_ref r{meta::resolve_type<ivec2>(), static_cast<const void*>(&cv)};
+            CHECK(r.get_ref_type() == meta::uvalue_ref::ref_types::const_lvalue);
+            CHECK(r.get_cdata() == &cv);
+
+            const meta::uvalue_ref r2{meta::resolve_type<ivec2>(), static_cast<void*>(nullptr)};
+            CHECK_FALSE(r2);
+            CHECK_FALSE(r2.get_type());
+        }
+    }
+
+    SUBCASE("ctors/lvalues") {
+        // references are made only to lvalues, temporaries wouldn't outlive them
+        static_assert(std::is_constructible_v<meta::uvalue_ref, ivec2&>);
+        static_assert(std::is_constructible_v<meta::uvalue_ref, const ivec2&>);
+        static_assert(!std::is_constructible_v<meta::uvalue_ref, ivec2&&>);
+        static_assert(!std::is_constructible_v<meta::uvalue_ref, const ivec2&&>);
+        static_assert(!std::is_constructible_v<meta::uvalue_ref, int>);
+
+        static_assert(std::is_constructible_v<meta::uvalue_ref, meta::uvalue&>);
+        static_assert(std::is_constructible_v<meta::uvalue_ref, const meta::uvalue&>);
+        static_assert(!std::is_constructible_v<meta::uvalue_ref, meta::uvalue&&>);
+        static_assert(!std::is_constructible_v<meta::uvalue_ref, const meta::uvalue&&>);
+
+        // and explicitly, so they aren't made by accident
+        static_assert(!std::is_convertible_v<ivec2&, meta::uvalue_ref>);
+        static_assert(!std::is_convertible_v<meta::uvalue&, meta::uvalue_ref>);
+
+        static_assert(std::is_copy_constructible_v<meta::uvalue_ref>);
+        static_assert(std::is_move_constructible_v<meta::uvalue_ref>);
+    }
+
+    SUBCASE("invoke") {
+        const meta::class_type ivec2_type = meta::resolve_type<ivec2>();
+        const meta::function length2 = ivec2_type.get_function("length2");
+        const meta::method dot = ivec2_type.get_method("dot");
+        REQUIRE((length2 && dot));
+
+        ivec2 v{1, 2};
+        meta::uvalue uv{ivec2{3, 4}};
+        const int i{42};
+
+        CHECK(length2.invoke(meta::uvalue_ref{v}).as<int>() == 5);
+        CHECK(length2.invoke(meta::uvalue_ref{uv}).as<int>() == 25);
+        CHECK(meta::invoke(length2, meta::uvalue_ref{v}).as<int>() == 5);
+        CHECK(meta::invoke(dot, meta::uvalue_ref{v}, meta::uvalue_ref{uv}).as<int>() == 11);
+        CHECK(dot.invoke(meta::uvalue_ref{uv}, meta::uvalue_ref{v}).as<int>() == 11);
+
+        CHECK(length2.is_invocable_with(meta::uvalue_ref{v}));
+        CHECK_FALSE(length2.is_invocable_with(meta::uvalue_ref{i}));
+        CHECK_FALSE(length2.try_invoke(meta::uvalue_ref{i}));
+
+        // nothing is copied or moved to pass the arguments
+        CHECK(ivec2::move_constructor_counter == 1);
+        CHECK(ivec2::copy_constructor_counter == 0);
+    }
+
+    SUBCASE("invoke/refs") {
+        const meta::class_type ivec2_type = meta::resolve_type<ivec2>();
+        const meta::function scale = ivec2_type.get_function("scale");
+        const meta::function steal_x = ivec2_type.get_function("steal_x");
+        REQUIRE((scale && steal_x));
+
+        ivec2 v{1, 2};
+        const ivec2 cv{1, 2};
+        const int s{2};
+
+        CHECK(scale.try_invoke(meta::uvalue_ref{v}, meta::uvalue_ref{s}));
+        CHECK(v.x == 2);
+        CHECK(v.y == 4);
+
+        CHECK_FALSE(scale.try_invoke(meta::uvalue_ref{cv}, meta::uvalue_ref{s}));
+        CHECK_FALSE(steal_x.try_invoke(meta::uvalue_ref{v}));
+
+        const meta::uvalue_ref rv{meta::resolve_type<ivec2>(), static_cast<void*>(&v), meta::uvalue_ref::ref_types::rvalue};
+        CHECK(steal_x.invoke(rv).as<int>() == 2);
+        CHECK(v.x == 0);
+    }
+
+    SUBCASE("invoke_variadic") {
+        const meta::method dot = meta::resolve_type<ivec2>().get_method("dot");
+        REQUIRE(dot);
+
+        ivec2 v1{1, 2};
+        ivec2 v2{3, 4};
+
+        std::vector<meta::uvalue_ref> stack{meta::uvalue_ref{v2}};
+        CHECK(dot.invoke_variadic(v1, stack.begin(), stack.end()).as<int>() == 11);
+        CHECK(dot.invoke_variadic(v1, std::span{stack}).as<int>() == 11);
+        CHECK(dot.invoke_variadic(meta::uvalue_ref{v1}, std::span{stack}).as<int>() == 11);
+
+        CHECK(ivec2::move_constructor_counter == 0);
+        CHECK(ivec2::copy_constructor_counter == 0);
+    }
+
+    SUBCASE("set") {
+        const meta::class_type holder_type = meta::resolve_type<holder>();
+        const meta::member value = holder_type.get_member("value");
+        const meta::variable static_value = holder_type.get_variable("static_value");
+        REQUIRE((value && static_value));
+
+        holder h;
+        const ivec2 v{1, 2};
+        const ivec2 v2{3, 4};
+        const int i{42};
+
+        value.set(h, meta::uvalue_ref{v});
+        CHECK(h.value.x == 1);
+        CHECK(h.value.y == 2);
+
+        value.set(meta::uvalue_ref{h}, meta::uvalue_ref{v2});
+        CHECK(h.value.x == 3);
+
+        CHECK_FALSE(value.try_set(meta::uvalue_ref{std::as_const(h)}, meta::uvalue_ref{v}));
+        CHECK_FALSE(value.try_set(h, meta::uvalue_ref{i}));
+
+        static_value.set(meta::uvalue_ref{v});
+        CHECK(holder::static_value.x == 1);
+        CHECK(holder::static_value.y == 2);
+    }
+
+    SUBCASE("create") {
+        const meta::class_type ivec2_type = meta::resolve_type<ivec2>();
+
+        const int x{5};
+        const int y{6};
+
+        const meta::uvalue v = ivec2_type.create(meta::uvalue_ref{x}, meta::uvalue_ref{y});
+        CHECK(v.as<ivec2>().x == 5);
+        CHECK(v.as<ivec2>().y == 6);
+
+        const meta::uvalue v2 = ivec2_type.create(meta::uvalue_ref{v});
+        CHECK(v2.as<ivec2>().x == 5);
+    }
+}
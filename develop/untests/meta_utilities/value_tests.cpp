@@ -409,6 +409,23 @@ TEST_CASE("meta/meta_utilities/value") {
         CHECK(ivec2::copy_constructor_counter == 0);
     }
 
+    SUBCASE("assign") {
+        meta::uvalue val{"hello, it's a long enough string"s};
+        const void* val_data = val.get_data();
+
+        CHECK(val.assign("world, it's a long enough string"s) == "world, it's a long enough string"s);
+        CHECK(val.get_data() == val_data);
+        CHECK(val.as<std::string>() == "world, it's a long enough string"s);
+
+        CHECK(val.assign(42) == 42);
+        CHECK(val.get_type() == meta::resolve_type<int>());
+        CHECK(val.as<int>() == 42);
+
+        CHECK(val.assign(ivec2{1,2}) == ivec2{1,2});
+        CHECK(val.assign(ivec2{3,4}) == ivec2{3,4});
+        CHECK(val.as<ivec2>() == ivec2{3,4});
+    }
+
     SUBCASE("swap/0") {
         meta::uvalue val1{"world"s};
         meta::uvalue val2{ivec2{1,2}};
@@ -6,6 +6,11 @@
 
 #pragma once
 
+#include "meta_async.hpp"
+#include "meta_async/invoke_async.hpp"
+#include "meta_async/thread_pool.hpp"
+#include "meta_async/uawaiter.hpp"
+
 #include "meta_base.hpp"
 
 #include "meta_binds.hpp"
@@ -38,8 +43,20 @@
 #include "meta_invoke.hpp"
 #include "meta_invoke/invoke.hpp"
 
+#include "meta_mapper.hpp"
+#include "meta_mapper/instance_mapper.hpp"
+
+#include "meta_plans.hpp"
+#include "meta_plans/function_plan.hpp"
+#include "meta_plans/method_plan.hpp"
+#include "meta_plans/typed_function.hpp"
+#include "meta_plans/typed_method.hpp"
+
 #include "meta_policies.hpp"
 
+#include "meta_profiler.hpp"
+#include "meta_profiler/profiler.hpp"
+
 #include "meta_registry.hpp"
 
 #include "meta_states.hpp"
@@ -77,3 +94,10 @@
 
 #include "meta_uvalue.hpp"
 #include "meta_uvalue/uvalue.hpp"
+#include "meta_uvalue/uvalue_resource.hpp"
+
+#include "meta_uvalue_array.hpp"
+#include "meta_uvalue_array/uvalue_array.hpp"
+
+#include "meta_uvalue_ref.hpp"
+#include "meta_uvalue_ref/uvalue_ref.hpp"
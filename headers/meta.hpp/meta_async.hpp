@@ -0,0 +1,154 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "meta_base.hpp"
+#include "meta_states.hpp"
+#include "meta_uvalue.hpp"
+
+#if defined(META_HPP_WITH_ASYNC)
+
+#    include <condition_variable>
+#    include <deque>
+#    include <future>
+#    include <thread>
+
+#    if !defined(META_HPP_NO_COROUTINES) && !defined(__cpp_lib_coroutine)
+#        define META_HPP_NO_COROUTINES
+#    endif
+
+#    if !defined(META_HPP_NO_COROUTINES)
+#        include <coroutine>
+#    endif
+
+namespace meta_hpp
+{
+    template < typename Executor >
+    concept executor_family                                          //
+        = requires(Executor& executor, std::function<void()> task) { //
+              executor.post(std::move(task));
+          };
+}
+
+namespace meta_hpp
+{
+    template < executor_family Executor, typename... Args >
+    [[nodiscard]] std::future<uvalue> invoke_async(Executor& executor, const function& function, Args&&... args);
+
+    template < executor_family Executor, typename Instance, typename... Args >
+    [[nodiscard]] std::future<uvalue> invoke_async(Executor& executor, const method& method, Instance&& instance, Args&&... args);
+}
+
+namespace meta_hpp
+{
+    class thread_pool final {
+    public:
+        explicit thread_pool(std::size_t thread_count = std::thread::hardware_concurrency());
+        ~thread_pool();
+
+        thread_pool(thread_pool&&) = delete;
+        thread_pool& operator=(thread_pool&&) = delete;
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        void post(std::function<void()> task);
+
+        [[nodiscard]] std::size_t get_thread_count() const noexcept;
+
+    private:
+        void stop() noexcept;
+        void run_worker();
+
+    private:
+        std::mutex mutex_;
+        std::condition_variable condition_;
+        std::deque<std::function<void()>> tasks_;
+        std::vector<std::thread> threads_;
+        bool stopping_{};
+    };
+}
+
+#    if !defined(META_HPP_NO_COROUTINES)
+
+namespace meta_hpp::detail
+{
+    template < typename T >
+    concept awaiter_kind                                         //
+        = requires(T& awaiter, std::coroutine_handle<> handle) { //
+              { awaiter.await_ready() } -> std::convertible_to<bool>;
+              awaiter.await_suspend(handle);
+              awaiter.await_resume();
+          };
+
+    template < typename T >
+    concept member_co_await_kind   //
+        = requires(T&& awaitable) { //
+              { std::forward<T>(awaitable).operator co_await() } -> awaiter_kind;
+          };
+
+    template < typename T >
+    concept free_co_await_kind     //
+        = requires(T&& awaitable) { //
+              { operator co_await(std::forward<T>(awaitable)) } -> awaiter_kind;
+          };
+
+    template < typename T >
+    concept awaitable_kind                                                    //
+        = std::is_same_v<T, std::remove_cvref_t<T>>                           //
+       && (awaiter_kind<T> || member_co_await_kind<T> || free_co_await_kind<T>); //
+}
+
+namespace meta_hpp
+{
+    class uawaiter final {
+    public:
+        uawaiter() = default;
+        ~uawaiter() noexcept;
+
+        uawaiter(uawaiter&& other) noexcept;
+        uawaiter& operator=(uawaiter&& other) noexcept;
+
+        uawaiter(const uawaiter&) = delete;
+        uawaiter& operator=(const uawaiter&) = delete;
+
+        explicit uawaiter(uvalue value) noexcept;
+
+        template < detail::awaitable_kind Awaitable >
+        explicit uawaiter(Awaitable&& awaitable);
+
+        [[nodiscard]] bool await_ready();
+        [[nodiscard]] std::coroutine_handle<> await_suspend(std::coroutine_handle<> handle);
+        [[nodiscard]] uvalue await_resume();
+
+        void swap(uawaiter& other) noexcept;
+
+    private:
+        struct vtable_t;
+
+        void* awaiter_{};
+        const vtable_t* vtable_{};
+        uvalue value_{};
+    };
+
+    inline void swap(uawaiter& l, uawaiter& r) noexcept {
+        l.swap(r);
+    }
+}
+
+namespace meta_hpp
+{
+    template < typename Awaitable = void, typename... Args >
+    [[nodiscard]] uawaiter co_invoke(const function& function, Args&&... args);
+
+    template < typename Awaitable = void, typename Instance, typename... Args >
+    [[nodiscard]] uawaiter co_invoke(const method& method, Instance&& instance, Args&&... args);
+}
+
+#    endif
+
+#endif
@@ -0,0 +1,92 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "../meta_async.hpp"
+#include "../meta_base.hpp"
+#include "../meta_states.hpp"
+#include "../meta_uvalue.hpp"
+
+#include "../meta_async/uawaiter.hpp"
+#include "../meta_states/function.hpp"
+#include "../meta_states/method.hpp"
+
+#if defined(META_HPP_WITH_ASYNC)
+
+namespace meta_hpp::detail
+{
+    template < executor_family Executor, typename State, typename... Args >
+    std::future<uvalue> post_try_invoke(Executor& executor, const State& state, Args&&... args) {
+        using args_t = std::tuple<std::unwrap_ref_decay_t<Args>...>;
+
+        auto task = std::make_shared<std::packaged_task<uvalue()>>(
+            [state, all_args = args_t{META_HPP_FWD(args)...}]() mutable {
+                uresult result = std::apply(
+                    [&state](auto&&... task_args) { //
+                        return state.try_invoke(META_HPP_FWD(task_args)...);
+                    },
+                    std::move(all_args)
+                );
+
+                if ( !result ) {
+                    throw_exception(result.get_error());
+                }
+
+                return std::move(*result);
+            }
+        );
+
+        std::future<uvalue> future{task->get_future()};
+        executor.post([task = std::move(task)]() { (*task)(); });
+        return future;
+    }
+}
+
+namespace meta_hpp
+{
+    template < executor_family Executor, typename... Args >
+    std::future<uvalue> invoke_async(Executor& executor, const function& function, Args&&... args) {
+        return detail::post_try_invoke(executor, function, META_HPP_FWD(args)...);
+    }
+
+    template < executor_family Executor, typename Instance, typename... Args >
+    std::future<uvalue> invoke_async(Executor& executor, const method& method, Instance&& instance, Args&&... args) {
+        return detail::post_try_invoke(executor, method, META_HPP_FWD(instance), META_HPP_FWD(args)...);
+    }
+}
+
+#    if !defined(META_HPP_NO_COROUTINES)
+
+namespace meta_hpp::detail
+{
+    template < typename Awaitable >
+    uawaiter make_uawaiter(uvalue&& result) {
+        if constexpr ( std::is_void_v<Awaitable> ) {
+            return uawaiter{std::move(result)};
+        } else {
+            static_assert(awaitable_kind<Awaitable>, "the result type must be an awaitable taken by value");
+            return uawaiter{std::move(result).template as<Awaitable>()};
+        }
+    }
+}
+
+namespace meta_hpp
+{
+    template < typename Awaitable, typename... Args >
+    uawaiter co_invoke(const function& function, Args&&... args) {
+        return detail::make_uawaiter<Awaitable>(function.invoke(META_HPP_FWD(args)...));
+    }
+
+    template < typename Awaitable, typename Instance, typename... Args >
+    uawaiter co_invoke(const method& method, Instance&& instance, Args&&... args) {
+        return detail::make_uawaiter<Awaitable>(method.invoke(META_HPP_FWD(instance), META_HPP_FWD(args)...));
+    }
+}
+
+#    endif
+
+#endif
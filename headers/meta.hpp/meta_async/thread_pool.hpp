@@ -0,0 +1,92 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "../meta_async.hpp"
+
+#if defined(META_HPP_WITH_ASYNC)
+
+namespace meta_hpp
+{
+    inline thread_pool::thread_pool(std::size_t thread_count) {
+        thread_count = std::max(thread_count, std::size_t{1});
+
+        // the destructor isn't called for a failed constructor,
+        // so the already started workers are stopped by the guard
+
+        // NOLINTNEXTLINE(*-special-member-functions)
+        struct start_guard final {
+            thread_pool* pool;
+
+            ~start_guard() noexcept {
+                if ( pool != nullptr ) {
+                    pool->stop();
+                }
+            }
+        } guard{this};
+
+        threads_.reserve(thread_count);
+        for ( std::size_t i{}; i < thread_count; ++i ) {
+            threads_.emplace_back([this]() { run_worker(); });
+        }
+
+        guard.pool = nullptr;
+    }
+
+    inline thread_pool::~thread_pool() {
+        stop();
+    }
+
+    inline void thread_pool::post(std::function<void()> task) {
+        {
+            const std::lock_guard<std::mutex> lock{mutex_};
+            tasks_.push_back(std::move(task));
+        }
+
+        condition_.notify_one();
+    }
+
+    inline std::size_t thread_pool::get_thread_count() const noexcept {
+        return threads_.size();
+    }
+
+    inline void thread_pool::stop() noexcept {
+        {
+            const std::lock_guard<std::mutex> lock{mutex_};
+            stopping_ = true;
+        }
+
+        condition_.notify_all();
+
+        for ( std::thread& thread : threads_ ) {
+            thread.join();
+        }
+    }
+
+    inline void thread_pool::run_worker() {
+        for ( ;; ) {
+            std::function<void()> task;
+
+            {
+                std::unique_lock<std::mutex> lock{mutex_};
+                condition_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+
+                if ( tasks_.empty() ) {
+                    // stopping and all posted tasks are done
+                    return;
+                }
+
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+
+            task();
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,146 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "../meta_async.hpp"
+
+#if defined(META_HPP_WITH_ASYNC)
+
+#    if !defined(META_HPP_NO_COROUTINES)
+
+namespace meta_hpp::detail
+{
+    template < awaitable_kind Awaitable >
+    decltype(auto) get_awaiter(Awaitable& awaitable) {
+        if constexpr ( member_co_await_kind<Awaitable> ) {
+            return std::move(awaitable).operator co_await();
+        } else if constexpr ( free_co_await_kind<Awaitable> ) {
+            return operator co_await(std::move(awaitable));
+        } else {
+            return (awaitable);
+        }
+    }
+
+    // Keeps the awaitable alive next to its awaiter, the awaiter
+    // may refer to the awaitable, so the state is never moved.
+
+    template < awaitable_kind Awaitable >
+    struct uawaiter_state final {
+        using awaiter_t = decltype(get_awaiter(std::declval<Awaitable&>()));
+
+        Awaitable awaitable;
+        awaiter_t awaiter;
+
+        explicit uawaiter_state(Awaitable&& other)
+        : awaitable{std::move(other)}
+        , awaiter{get_awaiter(awaitable)} {}
+    };
+}
+
+namespace meta_hpp
+{
+    struct uawaiter::vtable_t final {
+        // NOLINTBEGIN(*-avoid-const-or-ref-data-members)
+        bool (*const ready)(void* self);
+        std::coroutine_handle<> (*const suspend)(void* self, std::coroutine_handle<> handle);
+        uvalue (*const resume)(void* self);
+        void (*const destroy)(void* self) noexcept;
+        // NOLINTEND(*-avoid-const-or-ref-data-members)
+
+        template < typename Awaitable >
+        [[nodiscard]] static const vtable_t* get() noexcept {
+            using state_t = detail::uawaiter_state<Awaitable>;
+
+            static const vtable_t table{
+                .ready{[](void* self) -> bool { //
+                    return static_cast<bool>(static_cast<state_t*>(self)->awaiter.await_ready());
+                }},
+
+                .suspend{[](void* self, std::coroutine_handle<> handle) -> std::coroutine_handle<> {
+                    auto& awaiter = static_cast<state_t*>(self)->awaiter;
+                    using suspend_t = decltype(awaiter.await_suspend(handle));
+
+                    if constexpr ( std::is_void_v<suspend_t> ) {
+                        awaiter.await_suspend(handle);
+                        return std::noop_coroutine();
+                    } else if constexpr ( std::is_same_v<suspend_t, bool> ) {
+                        return awaiter.await_suspend(handle) ? std::noop_coroutine() : handle;
+                    } else {
+                        return awaiter.await_suspend(handle);
+                    }
+                }},
+
+                .resume{[](void* self) -> uvalue {
+                    auto& awaiter = static_cast<state_t*>(self)->awaiter;
+                    using resume_t = decltype(awaiter.await_resume());
+
+                    if constexpr ( std::is_void_v<resume_t> ) {
+                        awaiter.await_resume();
+                        return uvalue{};
+                    } else {
+                        return uvalue{awaiter.await_resume()};
+                    }
+                }},
+
+                .destroy{[](void* self) noexcept { //
+                    delete static_cast<state_t*>(self);
+                }},
+            };
+
+            return &table;
+        }
+    };
+
+    inline uawaiter::~uawaiter() noexcept {
+        if ( vtable_ != nullptr ) {
+            vtable_->destroy(awaiter_);
+        }
+    }
+
+    inline uawaiter::uawaiter(uawaiter&& other) noexcept
+    : awaiter_{std::exchange(other.awaiter_, nullptr)}
+    , vtable_{std::exchange(other.vtable_, nullptr)}
+    , value_{std::move(other.value_)} {}
+
+    inline uawaiter& uawaiter::operator=(uawaiter&& other) noexcept {
+        if ( this != &other ) {
+            uawaiter{std::move(other)}.swap(*this);
+        }
+        return *this;
+    }
+
+    inline uawaiter::uawaiter(uvalue value) noexcept
+    : value_{std::move(value)} {}
+
+    template < detail::awaitable_kind Awaitable >
+    uawaiter::uawaiter(Awaitable&& awaitable)
+    : awaiter_{new detail::uawaiter_state<Awaitable>{std::move(awaitable)}}
+    , vtable_{vtable_t::get<Awaitable>()} {}
+
+    inline bool uawaiter::await_ready() {
+        return vtable_ == nullptr || vtable_->ready(awaiter_);
+    }
+
+    inline std::coroutine_handle<> uawaiter::await_suspend(std::coroutine_handle<> handle) {
+        META_HPP_ASSERT(vtable_ != nullptr && "suspending on a ready awaiter");
+        return vtable_->suspend(awaiter_, handle);
+    }
+
+    inline uvalue uawaiter::await_resume() {
+        return vtable_ == nullptr ? std::move(value_) : vtable_->resume(awaiter_);
+    }
+
+    inline void uawaiter::swap(uawaiter& other) noexcept {
+        std::swap(awaiter_, other.awaiter_);
+        std::swap(vtable_, other.vtable_);
+        value_.swap(other.value_);
+    }
+}
+
+#    endif
+
+#endif
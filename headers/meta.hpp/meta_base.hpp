@@ -14,14 +14,20 @@
 #include "meta_base/fixed_function.hpp"
 #include "meta_base/fnv1a_hash.hpp"
 #include "meta_base/hash_composer.hpp"
-#include "meta_base/inline_vector.hpp"
 #include "meta_base/insert_or_assign.hpp"
+#include "meta_base/integral_index.hpp"
 #include "meta_base/is_in_place_type.hpp"
 #include "meta_base/memory_buffer.hpp"
+#include "meta_base/name_index.hpp"
 #include "meta_base/noncopyable.hpp"
 #include "meta_base/nonesuch.hpp"
+#include "meta_base/overload_cache.hpp"
 #include "meta_base/overloaded.hpp"
+#include "meta_base/published_index.hpp"
+#include "meta_base/published_list.hpp"
 #include "meta_base/select_overload.hpp"
+#include "meta_base/signature_index.hpp"
+#include "meta_base/small_vector.hpp"
 #include "meta_base/to_underlying.hpp"
 #include "meta_base/type_list.hpp"
 
@@ -45,14 +51,20 @@ namespace meta_hpp
     class uresult;
 
     class uvalue;
+    class uvalue_ref;
 
     namespace detail
     {
         class uarg_base;
         class uarg;
+        class uarg_plan;
 
         class uinst_base;
         class uinst;
+        class uinst_plan;
+        class uinst_batch;
+
+        class target_usink;
     }
 
     template < typename T >
@@ -60,6 +72,7 @@ namespace meta_hpp
         = std::is_same_v<T, uerror>             //
        || std::is_same_v<T, uresult>            //
        || std::is_same_v<T, uvalue>             //
+       || std::is_same_v<T, uvalue_ref>         //
        || std::is_same_v<T, detail::uarg_base>  //
        || std::is_same_v<T, detail::uarg>       //
        || std::is_same_v<T, detail::uinst_base> //
@@ -91,6 +104,15 @@ namespace meta_hpp
        || std::is_same_v<T, variable>;   //
 }
 
+namespace meta_hpp
+{
+    template < typename Signature >
+    class typed_function;
+
+    template < typename Signature >
+    class typed_method;
+}
+
 namespace meta_hpp
 {
     class any_type;
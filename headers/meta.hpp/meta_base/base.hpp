@@ -14,6 +14,8 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
 #include <compare>
 #include <exception>
 #include <functional>
@@ -22,12 +24,15 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <numeric>
+#include <optional>
 #include <set>
 #include <span>
 #include <string>
 #include <string_view>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include <version>
@@ -94,6 +99,18 @@
 #    endif
 #endif
 
+#if !defined(META_HPP_VARIADIC_INLINE_ARITY)
+#    define META_HPP_VARIADIC_INLINE_ARITY 8
+#endif
+
+#if !defined(META_HPP_UVALUE_INLINE_SIZE)
+#    define META_HPP_UVALUE_INLINE_SIZE (sizeof(void*) * 3)
+#endif
+
+#if !defined(META_HPP_UVALUE_INLINE_ALIGN)
+#    define META_HPP_UVALUE_INLINE_ALIGN alignof(std::max_align_t)
+#endif
+
 //
 //
 //
@@ -124,16 +141,6 @@
 //
 //
 
-#if META_HPP_DETAIL_COMPILER_ID == META_HPP_DETAIL_MSVC_COMPILER_ID
-#    define META_HPP_ALLOCA(size) _alloca(size)
-#else
-#    define META_HPP_ALLOCA(size) __builtin_alloca(size)
-#endif
-
-//
-//
-//
-
 #if META_HPP_DETAIL_COMPILER_ID == META_HPP_DETAIL_CLANG_COMPILER_ID
 #    define META_HPP_DETAIL_CLANG_PRAGMA_TO_STR(x) _Pragma(#x)
 #    define META_HPP_DETAIL_CLANG_IGNORE_WARNING(w) META_HPP_DETAIL_CLANG_PRAGMA_TO_STR(clang diagnostic ignored w)
@@ -172,16 +179,6 @@
 //
 //
 
-#define META_HPP_DETAIL_IGNORE_ALLOCA_WARNINGS_PUSH() \
-    META_HPP_DETAIL_CLANG_IGNORE_WARNINGS_PUSH() \
-    META_HPP_DETAIL_CLANG_IGNORE_WARNING("-Walloca")
-
-#define META_HPP_DETAIL_IGNORE_ALLOCA_WARNINGS_POP() META_HPP_DETAIL_CLANG_IGNORE_WARNINGS_POP()
-
-//
-//
-//
-
 #define META_HPP_DETAIL_IGNORE_OVERRIDE_WARNINGS_PUSH() \
     META_HPP_DETAIL_CLANG_IGNORE_WARNINGS_PUSH() \
     META_HPP_DETAIL_CLANG_IGNORE_WARNING("-Wunknown-warning-option") \
@@ -0,0 +1,103 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "base.hpp"
+
+namespace meta_hpp::detail
+{
+    // Maps integral keys to positions in a state list. Mostly contiguous keys
+    // are stored in a dense table indexed by the key offset, other key sets
+    // are kept sorted and found by a binary search.
+
+    class integral_index final {
+    public:
+        using key_type = std::uint64_t;
+        using entry_type = std::pair<key_type, std::size_t>;
+
+        static constexpr std::size_t npos{static_cast<std::size_t>(-1)};
+
+        integral_index() = default;
+
+        template < typename Integral >
+            requires std::is_integral_v<Integral>
+        [[nodiscard]] static constexpr key_type make_key(Integral value) noexcept {
+            if constexpr ( std::is_signed_v<Integral> ) {
+                // flips the sign bit to keep signed keys ordered
+                constexpr key_type sign_bit{key_type{1} << (sizeof(key_type) * 8 - 1)};
+                return static_cast<key_type>(static_cast<std::int64_t>(value)) ^ sign_bit;
+            } else {
+                return static_cast<key_type>(value);
+            }
+        }
+
+        [[nodiscard]] bool empty() const noexcept {
+            return sorted_.empty();
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return sorted_.size();
+        }
+
+        [[nodiscard]] bool is_dense() const noexcept {
+            return !dense_.empty();
+        }
+
+        [[nodiscard]] std::size_t find(key_type key) const noexcept {
+            if ( !dense_.empty() ) {
+                const key_type offset{key - dense_first_};
+                return offset < dense_.size() ? dense_[static_cast<std::size_t>(offset)] : npos;
+            }
+
+            const auto iter{std::lower_bound(sorted_.begin(), sorted_.end(), key, [](const entry_type& l, key_type r) {
+                return l.first < r;
+            })};
+
+            return iter != sorted_.end() && iter->first == key ? iter->second : npos;
+        }
+
+        void assign(std::vector<entry_type> entries) {
+            // the first position wins for duplicated keys
+            std::sort(entries.begin(), entries.end());
+            entries.erase(
+                std::unique(entries.begin(), entries.end(), [](const entry_type& l, const entry_type& r) {
+                    return l.first == r.first;
+                }),
+                entries.end()
+            );
+
+            sorted_.swap(entries);
+            dense_first_ = key_type{};
+            dense_.clear();
+
+            if ( sorted_.empty() ) {
+                return;
+            }
+
+            // at least half of the dense table must be used
+            const key_type span{sorted_.back().first - sorted_.front().first};
+            if ( span / 2 < sorted_.size() ) {
+                dense_first_ = sorted_.front().first;
+                dense_.resize(static_cast<std::size_t>(span) + 1, npos);
+                for ( auto&& [key, position] : sorted_ ) {
+                    dense_[static_cast<std::size_t>(key - dense_first_)] = position;
+                }
+            }
+        }
+
+        void clear() noexcept {
+            sorted_.clear();
+            dense_first_ = key_type{};
+            dense_.clear();
+        }
+
+    private:
+        std::vector<entry_type> sorted_;
+        key_type dense_first_{};
+        std::vector<std::size_t> dense_;
+    };
+}
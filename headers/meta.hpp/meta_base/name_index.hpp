@@ -0,0 +1,87 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "base.hpp"
+#include "insert_or_assign.hpp"
+
+namespace meta_hpp::detail
+{
+    // Maps a name to the position of its first occurrence in a state list.
+    // Keys are views of the names owned by the indexed states, so the index
+    // must be cleared together with the list it was built for.
+
+    class name_index final {
+    public:
+        static constexpr std::size_t npos{static_cast<std::size_t>(-1)};
+
+        name_index() = default;
+
+        [[nodiscard]] bool empty() const noexcept {
+            return positions_.empty();
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return positions_.size();
+        }
+
+        [[nodiscard]] std::size_t find(std::string_view name) const noexcept {
+            const auto iter{positions_.find(name)};
+            return iter != positions_.end() ? iter->second : npos;
+        }
+
+        void assign(std::string_view name, std::size_t position) {
+            if ( auto&& [iter, inserted] = positions_.try_emplace(name, position); !inserted ) {
+                if ( iter->second >= position ) {
+                    // the key must point to the name owned by the state at this position
+                    positions_.erase(iter);
+                    positions_.emplace(name, position);
+                }
+            }
+        }
+
+        void release(std::string_view name, std::size_t position) noexcept {
+            // must be called before the state at this position is replaced,
+            // while the key still points to the name owned by the state
+            if ( auto iter{positions_.find(name)}; iter != positions_.end() && iter->second == position ) {
+                positions_.erase(iter);
+            }
+        }
+
+        void clear() noexcept {
+            positions_.clear();
+        }
+
+    private:
+        std::unordered_map<std::string_view, std::size_t> positions_;
+    };
+
+    template < typename State, typename Allocator >
+    typename std::vector<State, Allocator>::iterator insert_or_assign( //
+        std::vector<State, Allocator>& vector,
+        name_index& index,
+        typename std::vector<State, Allocator>::value_type&& value
+    ) {
+        if ( auto&& iter{std::find(vector.begin(), vector.end(), value)}; iter != vector.end() ) {
+            index.release(iter->get_name(), static_cast<std::size_t>(iter - vector.begin()));
+        }
+
+        const auto iter{insert_or_assign(vector, std::move(value))};
+        index.assign(iter->get_name(), static_cast<std::size_t>(iter - vector.begin()));
+        return iter;
+    }
+
+    template < typename State, typename Allocator >
+    [[nodiscard]] State find_by_name( //
+        const std::vector<State, Allocator>& vector,
+        const name_index& index,
+        std::string_view name
+    ) noexcept {
+        const std::size_t position{index.find(name)};
+        return position < vector.size() ? vector[position] : State{};
+    }
+}
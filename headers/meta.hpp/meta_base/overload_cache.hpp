@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "base.hpp"
+#include "hash_composer.hpp"
+
+namespace meta_hpp::detail
+{
+    // Remembers which overload was chosen for a given shape of call arguments.
+    // A shape is a flat sequence of words describing the arguments (their types
+    // and reference kinds), and a remembered 'npos' means no overload was viable.
+    //
+    // The cache is a few direct-mapped slots keyed by the hash of a shape. Slots
+    // keep short shapes inline and are guarded by sequence counters, so lookups
+    // don't lock or allocate. Longer shapes and racing insertions are not cached.
+
+    class overload_cache final {
+    public:
+        static constexpr std::size_t npos{static_cast<std::size_t>(-1)};
+        static constexpr std::size_t max_shape_size{8};
+        static constexpr std::size_t slot_count{8};
+
+        overload_cache() = default;
+
+        ~overload_cache() {
+            delete[] slots_.load(std::memory_order_acquire);
+        }
+
+        overload_cache(overload_cache&&) = delete;
+        overload_cache& operator=(overload_cache&&) = delete;
+
+        overload_cache(const overload_cache&) = delete;
+        overload_cache& operator=(const overload_cache&) = delete;
+
+        [[nodiscard]] std::optional<std::size_t> find(std::span<const std::size_t> shape) const noexcept {
+            const slot_t* slots{slots_.load(std::memory_order_acquire)};
+            if ( slots == nullptr || shape.size() > max_shape_size ) {
+                return std::nullopt;
+            }
+
+            const std::size_t hash{make_hash(shape)};
+            const slot_t& slot{slots[hash % slot_count]};
+
+            const std::size_t sequence{slot.sequence.load(std::memory_order_acquire)};
+            if ( (sequence & 1U) != 0 || slot.hash.load(std::memory_order_acquire) != hash ) {
+                return std::nullopt;
+            }
+
+            // the words are written with release, so seeing any word of a newer
+            // write makes the second sequence load see that write in progress
+            bool same_shape{slot.size.load(std::memory_order_acquire) == shape.size()};
+            for ( std::size_t i{}; i < shape.size(); ++i ) {
+                same_shape = same_shape && slot.shape[i].load(std::memory_order_acquire) == shape[i];
+            }
+
+            const std::size_t position{slot.position.load(std::memory_order_acquire)};
+
+            if ( !same_shape || slot.sequence.load(std::memory_order_relaxed) != sequence ) {
+                return std::nullopt;
+            }
+
+            return position;
+        }
+
+        void insert(std::span<const std::size_t> shape, std::size_t position) {
+            if ( shape.size() > max_shape_size ) {
+                return;
+            }
+
+            slot_t* slots{slots_.load(std::memory_order_acquire)};
+            if ( slots == nullptr ) {
+                auto new_slots{std::make_unique<slot_t[]>(slot_count)};
+                if ( slots_.compare_exchange_strong(slots, new_slots.get(), std::memory_order_acq_rel) ) {
+                    slots = new_slots.release();
+                }
+            }
+
+            const std::size_t hash{make_hash(shape)};
+            slot_t& slot{slots[hash % slot_count]};
+
+            std::size_t sequence{slot.sequence.load(std::memory_order_relaxed)};
+            if ( (sequence & 1U) != 0 || !slot.sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_acquire) ) {
+                return;
+            }
+
+            slot.hash.store(hash, std::memory_order_release);
+            slot.size.store(shape.size(), std::memory_order_release);
+            for ( std::size_t i{}; i < shape.size(); ++i ) {
+                slot.shape[i].store(shape[i], std::memory_order_release);
+            }
+            slot.position.store(position, std::memory_order_release);
+
+            slot.sequence.store(sequence + 2, std::memory_order_release);
+        }
+
+        void clear() noexcept {
+            if ( slot_t* slots{slots_.load(std::memory_order_acquire)} ) {
+                for ( std::size_t i{}; i < slot_count; ++i ) {
+                    slot_t& slot{slots[i]};
+
+                    std::size_t sequence{slot.sequence.load(std::memory_order_relaxed)};
+                    while ( (sequence & 1U) != 0 || !slot.sequence.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire) ) {
+                        sequence = slot.sequence.load(std::memory_order_relaxed);
+                    }
+
+                    slot.size.store(npos, std::memory_order_release);
+                    slot.sequence.store(sequence + 2, std::memory_order_release);
+                }
+            }
+        }
+
+    private:
+        struct slot_t final {
+            std::atomic<std::size_t> sequence{};
+            std::atomic<std::size_t> hash{};
+            std::atomic<std::size_t> size{npos};
+            std::atomic<std::size_t> position{npos};
+            std::array<std::atomic<std::size_t>, max_shape_size> shape{};
+        };
+
+        [[nodiscard]] static std::size_t make_hash(std::span<const std::size_t> shape) noexcept {
+            hash_composer hash{hash_composer{} << shape.size()};
+            for ( const std::size_t word : shape ) {
+                hash << word;
+            }
+            return hash;
+        }
+
+    private:
+        std::atomic<slot_t*> slots_{};
+    };
+}
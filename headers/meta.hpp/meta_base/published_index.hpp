@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "base.hpp"
+
+namespace meta_hpp::detail
+{
+    // An insert-only hash index of positions in a list that can be read without
+    // any locking. Keys aren't stored, so found positions are verified by the
+    // caller. A full table is replaced by a twice larger one, and replaced
+    // tables are kept until the index is destroyed because readers may still
+    // probe them. Insertions must be serialized by the caller.
+
+    class published_index final {
+    public:
+        static constexpr std::size_t npos{static_cast<std::size_t>(-1)};
+
+        published_index() = default;
+        ~published_index() = default;
+
+        published_index(published_index&&) = delete;
+        published_index& operator=(published_index&&) = delete;
+
+        published_index(const published_index&) = delete;
+        published_index& operator=(const published_index&) = delete;
+
+        template < typename Predicate >
+        // NOLINTNEXTLINE(*-missing-std-forward)
+        [[nodiscard]] std::size_t find(std::size_t hash, Predicate&& pred) const {
+            const table_t* table{table_.load(std::memory_order_acquire)};
+
+            if ( table == nullptr ) {
+                return npos;
+            }
+
+            for ( std::size_t slot_index{hash & table->mask};; slot_index = (slot_index + 1) & table->mask ) {
+                const slot_t& slot{table->slots[slot_index]};
+
+                const std::size_t position{slot.position.load(std::memory_order_acquire)};
+
+                if ( position == 0 ) {
+                    return npos;
+                }
+
+                if ( slot.hash.load(std::memory_order_relaxed) == hash && std::invoke(pred, position - 1) ) {
+                    return position - 1;
+                }
+            }
+        }
+
+        void insert(std::size_t hash, std::size_t position) {
+            table_t* table{table_.load(std::memory_order_relaxed)};
+
+            // keeps the table at most half full to keep probing sequences short
+            if ( table == nullptr || (size_ + 1) * 2 > table->mask + 1 ) {
+                table = grow(table);
+            }
+
+            insert(*table, hash, position);
+            ++size_;
+        }
+
+    private:
+        struct slot_t final {
+            std::atomic<std::size_t> hash{};
+            std::atomic<std::size_t> position{};
+        };
+
+        struct table_t final {
+            std::size_t mask{};
+            std::unique_ptr<slot_t[]> slots;
+        };
+
+        static void insert(table_t& table, std::size_t hash, std::size_t position) noexcept {
+            std::size_t slot_index{hash & table.mask};
+
+            while ( table.slots[slot_index].position.load(std::memory_order_relaxed) != 0 ) {
+                slot_index = (slot_index + 1) & table.mask;
+            }
+
+            // the position is published last, readers ignore empty slots
+            table.slots[slot_index].hash.store(hash, std::memory_order_relaxed);
+            table.slots[slot_index].position.store(position + 1, std::memory_order_release);
+        }
+
+        table_t* grow(const table_t* table) {
+            const std::size_t new_capacity{table != nullptr ? (table->mask + 1) * 2 : 16};
+
+            auto new_table{std::make_unique<table_t>()};
+            new_table->mask = new_capacity - 1;
+            new_table->slots = std::make_unique<slot_t[]>(new_capacity);
+
+            if ( table != nullptr ) {
+                for ( std::size_t slot_index{}; slot_index <= table->mask; ++slot_index ) {
+                    const slot_t& slot{table->slots[slot_index]};
+                    if ( const std::size_t position{slot.position.load(std::memory_order_relaxed)}; position != 0 ) {
+                        insert(*new_table, slot.hash.load(std::memory_order_relaxed), position - 1);
+                    }
+                }
+            }
+
+            tables_.push_back(std::move(new_table));
+            table_.store(tables_.back().get(), std::memory_order_release);
+            return tables_.back().get();
+        }
+
+    private:
+        std::size_t size_{};
+        std::atomic<table_t*> table_{};
+        std::vector<std::unique_ptr<table_t>> tables_;
+    };
+}
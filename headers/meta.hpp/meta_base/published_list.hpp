@@ -0,0 +1,97 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "base.hpp"
+
+namespace meta_hpp::detail
+{
+    // An append-only list that can be read without any locking. Values are
+    // stored in segments of growing sizes and never move, and a new value is
+    // published by the release of the list size, so readers always see
+    // a complete prefix of the list. Appends must be serialized by the caller.
+
+    template < typename T >
+    class published_list final {
+    public:
+        published_list() = default;
+
+        ~published_list() {
+            const std::size_t size{size_.load(std::memory_order_acquire)};
+
+            for ( std::size_t index{}; index < size; ++index ) {
+                std::destroy_at(std::addressof((*this)[index]));
+            }
+
+            for ( std::size_t segment{}; segment < max_segments; ++segment ) {
+                if ( segments_[segment] != nullptr ) {
+                    std::allocator<T>{}.deallocate(segments_[segment], segment_size(segment));
+                }
+            }
+        }
+
+        published_list(published_list&&) = delete;
+        published_list& operator=(published_list&&) = delete;
+
+        published_list(const published_list&) = delete;
+        published_list& operator=(const published_list&) = delete;
+
+        [[nodiscard]] bool empty() const noexcept {
+            return size() == 0;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return size_.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]] const T& operator[](std::size_t index) const noexcept {
+            const std::size_t segment{segment_of(index)};
+            return segments_[segment][index - segment_first(segment)];
+        }
+
+        template < typename F >
+        // NOLINTNEXTLINE(*-missing-std-forward)
+        void for_each(F&& f) const {
+            for ( std::size_t index{}, size{this->size()}; index < size; ++index ) {
+                std::invoke(f, (*this)[index]);
+            }
+        }
+
+        const T& push_back(T value) {
+            const std::size_t index{size_.load(std::memory_order_relaxed)};
+            const std::size_t segment{segment_of(index)};
+
+            if ( segments_[segment] == nullptr ) {
+                segments_[segment] = std::allocator<T>{}.allocate(segment_size(segment));
+            }
+
+            T* value_ptr{std::construct_at(segments_[segment] + (index - segment_first(segment)), std::move(value))};
+            size_.store(index + 1, std::memory_order_release);
+            return *value_ptr;
+        }
+
+    private:
+        static constexpr std::size_t first_segment_size{16};
+        static constexpr std::size_t max_segments{sizeof(std::size_t) * 8 - 4};
+
+        [[nodiscard]] static constexpr std::size_t segment_of(std::size_t index) noexcept {
+            return static_cast<std::size_t>(std::bit_width(index / first_segment_size + 1)) - 1;
+        }
+
+        [[nodiscard]] static constexpr std::size_t segment_first(std::size_t segment) noexcept {
+            return first_segment_size * ((std::size_t{1} << segment) - 1);
+        }
+
+        [[nodiscard]] static constexpr std::size_t segment_size(std::size_t segment) noexcept {
+            return first_segment_size << segment;
+        }
+
+    private:
+        std::atomic<std::size_t> size_{};
+        std::array<T*, max_segments> segments_{};
+    };
+}
@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "base.hpp"
+#include "hash_composer.hpp"
+#include "insert_or_assign.hpp"
+#include "name_index.hpp"
+
+namespace meta_hpp::detail
+{
+    // Maps a hash of a name and exact argument types to the positions of
+    // the states with that signature. Hashes may collide, so every found
+    // position must be verified by the caller.
+
+    class signature_index final {
+    public:
+        static constexpr std::size_t npos{static_cast<std::size_t>(-1)};
+
+        signature_index() = default;
+
+        template < typename Iter >
+        [[nodiscard]] static std::size_t make_signature(std::string_view name, Iter first, Iter last) noexcept {
+            hash_composer signature{hash_composer{} << name};
+            for ( ; first != last; ++first ) {
+                signature << first->get_hash();
+            }
+            return signature;
+        }
+
+        template < typename State >
+        [[nodiscard]] static std::size_t make_signature(const State& state) noexcept {
+            const auto& args = state.get_type().get_argument_types();
+            if constexpr ( requires { state.get_name(); } ) {
+                return make_signature(state.get_name(), args.begin(), args.end());
+            } else {
+                return make_signature(std::string_view{}, args.begin(), args.end());
+            }
+        }
+
+        [[nodiscard]] bool empty() const noexcept {
+            return positions_.empty();
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return positions_.size();
+        }
+
+        template < typename Predicate >
+        // NOLINTNEXTLINE(*-missing-std-forward)
+        [[nodiscard]] std::size_t find_first(std::size_t signature, Predicate&& pred) const {
+            std::size_t first_position{npos};
+            for ( auto&& [first, last] = positions_.equal_range(signature); first != last; ++first ) {
+                if ( first->second < first_position && std::invoke(pred, first->second) ) {
+                    first_position = first->second;
+                }
+            }
+            return first_position;
+        }
+
+        void assign(std::size_t signature, std::size_t position) {
+            for ( auto&& [first, last] = positions_.equal_range(signature); first != last; ++first ) {
+                if ( first->second == position ) {
+                    return;
+                }
+            }
+            positions_.emplace(signature, position);
+        }
+
+        void clear() noexcept {
+            positions_.clear();
+        }
+
+    private:
+        std::unordered_multimap<std::size_t, std::size_t> positions_;
+    };
+
+    template < typename State, typename Allocator >
+    typename std::vector<State, Allocator>::iterator insert_or_assign( //
+        std::vector<State, Allocator>& vector,
+        signature_index& index,
+        typename std::vector<State, Allocator>::value_type&& value
+    ) {
+        const auto iter{insert_or_assign(vector, std::move(value))};
+        index.assign(signature_index::make_signature(*iter), static_cast<std::size_t>(iter - vector.begin()));
+        return iter;
+    }
+
+    template < typename State, typename Allocator >
+    typename std::vector<State, Allocator>::iterator insert_or_assign( //
+        std::vector<State, Allocator>& vector,
+        name_index& names,
+        signature_index& signatures,
+        typename std::vector<State, Allocator>::value_type&& value
+    ) {
+        const auto iter{insert_or_assign(vector, names, std::move(value))};
+        signatures.assign(signature_index::make_signature(*iter), static_cast<std::size_t>(iter - vector.begin()));
+        return iter;
+    }
+}
@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "base.hpp"
+#include "memory_buffer.hpp"
+
+namespace meta_hpp::detail
+{
+    // A per-thread pool of buffers for small vectors that don't fit in place.
+    // Buffers are returned in any order, so a vector may outlive the vectors
+    // created after it (e.g. by calls from other fibers of the same thread).
+
+    class small_vector_pool final {
+    public:
+        static constexpr std::size_t max_buffers{8};
+
+        [[nodiscard]] static small_vector_pool& instance() {
+            thread_local small_vector_pool instance;
+            return instance;
+        }
+
+        [[nodiscard]] memory_buffer acquire(std::size_t size, std::align_val_t align) {
+            for ( auto iter{buffers_.begin()}; iter != buffers_.end(); ++iter ) {
+                if ( iter->get_size() >= size && iter->get_align() >= align ) {
+                    memory_buffer buffer{std::move(*iter)};
+                    buffers_.erase(iter);
+                    return buffer;
+                }
+            }
+            return memory_buffer{size, align};
+        }
+
+        void release(memory_buffer buffer) noexcept {
+            if ( buffers_.size() < max_buffers ) {
+                buffers_.push_back(std::move(buffer));
+            }
+        }
+
+    private:
+        small_vector_pool() {
+            buffers_.reserve(max_buffers);
+        }
+
+    private:
+        std::vector<memory_buffer> buffers_;
+    };
+}
+
+namespace meta_hpp::detail
+{
+    // Keeps up to N elements in place and takes memory for larger
+    // capacities from the pool, so it never grows the stack dynamically.
+
+    template < typename T, std::size_t N >
+    class small_vector final {
+    public:
+        small_vector() = delete;
+
+        small_vector(small_vector&&) = delete;
+        small_vector& operator=(small_vector&&) = delete;
+
+        small_vector(const small_vector&) = delete;
+        small_vector& operator=(const small_vector&) = delete;
+
+        explicit small_vector(std::size_t capacity) {
+            if ( capacity > N ) {
+                buffer_ = small_vector_pool::instance().acquire(sizeof(T) * capacity, std::align_val_t{alignof(T)});
+                begin_ = static_cast<T*>(buffer_.get_data());
+            } else {
+                begin_ = static_cast<T*>(static_cast<void*>(storage_.data()));
+            }
+
+            end_ = begin_;
+            capacity_ = begin_ + capacity; // NOLINT(*-pointer-arithmetic)
+        }
+
+        ~small_vector() {
+            std::destroy(begin_, end_);
+
+            if ( buffer_ ) {
+                small_vector_pool::instance().release(std::move(buffer_));
+            }
+        }
+
+        // clang-format off
+
+        [[nodiscard]] T* data() noexcept { return begin_; }
+        [[nodiscard]] const T* data() const noexcept { return begin_; }
+
+        [[nodiscard]] T* begin() noexcept { return begin_; }
+        [[nodiscard]] const T* begin() const noexcept { return begin_; }
+        [[nodiscard]] const T* cbegin() const noexcept { return begin_; }
+
+        [[nodiscard]] T* end() noexcept { return end_; }
+        [[nodiscard]] const T* end() const noexcept { return end_; }
+        [[nodiscard]] const T* cend() const noexcept { return end_; }
+
+        // clang-format on
+
+        template < typename... Args >
+        T& emplace_back(Args&&... args) {
+            META_HPP_ASSERT(end_ < capacity_ && "full vector");
+            T& result = *std::construct_at(end_, std::forward<Args>(args)...);
+            ++end_; // NOLINT(*-pointer-arithmetic)
+            return result;
+        }
+
+        [[nodiscard]] std::size_t get_size() const noexcept {
+            return static_cast<std::size_t>(end_ - begin_);
+        }
+
+        [[nodiscard]] std::size_t get_capacity() const noexcept {
+            return static_cast<std::size_t>(capacity_ - begin_);
+        }
+
+    private:
+        alignas(T) std::array<std::byte, sizeof(T) * N> storage_;
+        memory_buffer buffer_;
+        T* begin_{};
+        T* end_{};
+        T* capacity_{};
+    };
+}
@@ -80,6 +80,13 @@ namespace meta_hpp
     class class_bind final : public type_bind_base<class_type> {
     public:
         explicit class_bind(metadata_map metadata);
+        ~class_bind();
+
+        class_bind(class_bind&&) = delete;
+        class_bind& operator=(class_bind&&) = delete;
+
+        class_bind(const class_bind&) = delete;
+        class_bind& operator=(const class_bind&) = delete;
 
         template < typename... Args, typename... Opts >
             requires class_constructor_kind<Class, Args...>
@@ -112,6 +119,13 @@ namespace meta_hpp
     class enum_bind final : public type_bind_base<enum_type> {
     public:
         explicit enum_bind(metadata_map metadata);
+        ~enum_bind();
+
+        enum_bind(enum_bind&&) = delete;
+        enum_bind& operator=(enum_bind&&) = delete;
+
+        enum_bind(const enum_bind&) = delete;
+        enum_bind& operator=(const enum_bind&) = delete;
 
         template < typename... Opts >
         enum_bind& evalue_(std::string name, Enum value, Opts&&... opts);
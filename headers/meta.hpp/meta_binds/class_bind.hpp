@@ -22,6 +22,13 @@ namespace meta_hpp
         }
     }
 
+    template < class_kind Class >
+    class_bind<Class>::~class_bind() {
+        // the bind still holds the registry lock, so the tables of
+        // the class and its derived classes are built once per bind
+        get_data().update_flat_lookup();
+    }
+
     template < class_kind Class >
     template < typename... Args, typename... Opts >
         requires class_constructor_kind<Class, Args...>
@@ -54,7 +61,9 @@ namespace meta_hpp
             state_access(arg)->metadata = std::move(arguments[i].get_metadata());
         }
 
-        insert_or_assign(get_data().constructors, constructor{std::move(state)});
+        class_type_data& data{get_data()};
+        insert_or_assign(data.constructors, data.constructor_signatures, constructor{std::move(state)});
+        data.constructor_overloads.clear();
         return *this;
     }
 
@@ -100,7 +109,9 @@ namespace meta_hpp
             state_access(arg)->metadata = std::move(arguments[i].get_metadata());
         }
 
-        insert_or_assign(get_data().functions, function{std::move(state)});
+        class_type_data& data{get_data()};
+        insert_or_assign(data.functions, data.function_names, data.function_signatures, function{std::move(state)});
+        data.invalidate_flat_lookup();
         return *this;
     }
 
@@ -119,7 +130,9 @@ namespace meta_hpp
 
         metadata_bind::values_t metadata = metadata_bind::from_opts(META_HPP_FWD(opts)...);
         auto state = member_state::make<policy_t>(std::move(name), member_ptr, std::move(metadata));
-        insert_or_assign(get_data().members, member{std::move(state)});
+        class_type_data& data{get_data()};
+        insert_or_assign(data.members, data.member_names, member{std::move(state)});
+        data.invalidate_flat_lookup();
         return *this;
     }
 
@@ -154,14 +167,18 @@ namespace meta_hpp
             state_access(arg)->metadata = std::move(arguments[i].get_metadata());
         }
 
-        insert_or_assign(get_data().methods, method{std::move(state)});
+        class_type_data& data{get_data()};
+        insert_or_assign(data.methods, data.method_names, data.method_signatures, method{std::move(state)});
+        data.invalidate_flat_lookup();
         return *this;
     }
 
     template < class_kind Class >
     template < typename Type >
     class_bind<Class>& class_bind<Class>::typedef_(std::string name) {
-        get_data().typedefs.insert_or_assign(std::move(name), resolve_type<Type>());
+        detail::class_type_data& data{get_data()};
+        data.typedefs.insert_or_assign(std::move(name), resolve_type<Type>());
+        data.invalidate_flat_lookup();
         return *this;
     }
 
@@ -180,7 +197,9 @@ namespace meta_hpp
 
         metadata_bind::values_t metadata = metadata_bind::from_opts(META_HPP_FWD(opts)...);
         auto state = variable_state::make<policy_t>(std::move(name), variable_ptr, std::move(metadata));
-        insert_or_assign(get_data().variables, variable{std::move(state)});
+        class_type_data& data{get_data()};
+        insert_or_assign(data.variables, data.variable_names, variable{std::move(state)});
+        data.invalidate_flat_lookup();
         return *this;
     }
 }
@@ -16,12 +16,19 @@ namespace meta_hpp
     enum_bind<Enum>::enum_bind(metadata_map metadata)
     : type_bind_base{resolve_type<Enum>(), std::move(metadata)} {}
 
+    template < enum_kind Enum >
+    enum_bind<Enum>::~enum_bind() {
+        // the bind still holds the registry lock, so the value index is built once per bind
+        get_data().update_value_index();
+    }
+
     template < enum_kind Enum >
     template < typename... Opts >
     enum_bind<Enum>& enum_bind<Enum>::evalue_(std::string name, Enum value, Opts&&... opts) {
         metadata_bind::values_t metadata = metadata_bind::from_opts(META_HPP_FWD(opts)...);
         auto state = detail::evalue_state::make(std::move(name), std::move(value), std::move(metadata));
-        detail::insert_or_assign(get_data().evalues, evalue{std::move(state)});
+        detail::enum_type_data& data{get_data()};
+        detail::insert_or_assign(data.evalues, data.evalue_names, evalue{std::move(state)});
         return *this;
     }
 }
@@ -45,7 +45,8 @@ namespace meta_hpp
             state_access(arg)->metadata = std::move(arguments[i].get_metadata());
         }
 
-        insert_or_assign(get_state().functions, function{std::move(state)});
+        scope_state& data{get_state()};
+        insert_or_assign(data.functions, data.function_names, data.function_signatures, function{std::move(state)});
         return *this;
     }
 
@@ -69,7 +70,8 @@ namespace meta_hpp
 
         metadata_bind::values_t metadata = metadata_bind::from_opts(META_HPP_FWD(opts)...);
         auto state = variable_state::make<policy_t>(std::move(name), variable_ptr, std::move(metadata));
-        insert_or_assign(get_state().variables, variable{std::move(state)});
+        scope_state& data{get_state()};
+        insert_or_assign(data.variables, data.variable_names, variable{std::move(state)});
         return *this;
     }
 }
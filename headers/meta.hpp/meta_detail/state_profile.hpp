@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "../meta_base.hpp"
+
+#if defined(META_HPP_WITH_PROFILER)
+
+#    include <chrono>
+
+namespace meta_hpp::detail
+{
+    inline constexpr std::size_t error_code_count{to_underlying(error_code::argument_type_mismatch) + 1};
+
+    class state_profile final {
+    public:
+        // the first bucket counts zero latencies, the bucket I
+        // counts latencies in the [2^(I-1), 2^I) nanoseconds range
+        static constexpr std::size_t bucket_count{40};
+
+        state_profile() = default;
+        ~state_profile() = default;
+
+        // states are moved only while they are made, so relaxed loads are enough
+        state_profile(state_profile&& other) noexcept;
+        state_profile& operator=(state_profile&&) = delete;
+
+        state_profile(const state_profile&) = delete;
+        state_profile& operator=(const state_profile&) = delete;
+
+        void record_call(std::chrono::nanoseconds latency) noexcept;
+        void record_error(error_code error) noexcept;
+
+        [[nodiscard]] std::uint64_t get_calls() const noexcept;
+        [[nodiscard]] std::uint64_t get_total_nanoseconds() const noexcept;
+        [[nodiscard]] std::uint64_t get_errors(error_code error) const noexcept;
+        [[nodiscard]] std::uint64_t get_bucket(std::size_t bucket) const noexcept;
+
+        void reset() noexcept;
+
+    private:
+        std::atomic<std::uint64_t> calls_{};
+        std::atomic<std::uint64_t> total_nanoseconds_{};
+        std::array<std::atomic<std::uint64_t>, error_code_count> errors_{};
+        std::array<std::atomic<std::uint64_t>, bucket_count> buckets_{};
+    };
+
+    class state_profile_scope final {
+    public:
+        explicit state_profile_scope(state_profile& profile) noexcept
+        : profile_{&profile}
+        , start_{std::chrono::steady_clock::now()} {}
+
+        ~state_profile_scope() noexcept {
+            profile_->record_call(std::chrono::steady_clock::now() - start_);
+        }
+
+        state_profile_scope(state_profile_scope&&) = delete;
+        state_profile_scope& operator=(state_profile_scope&&) = delete;
+
+        state_profile_scope(const state_profile_scope&) = delete;
+        state_profile_scope& operator=(const state_profile_scope&) = delete;
+
+    private:
+        state_profile* profile_{};
+        std::chrono::steady_clock::time_point start_;
+    };
+
+    template < typename Result >
+    Result profile_result(state_profile& profile, Result&& result) noexcept {
+        if ( result.has_error() ) {
+            profile.record_error(result.get_error());
+        }
+        return std::forward<Result>(result);
+    }
+}
+
+namespace meta_hpp::detail
+{
+    inline state_profile::state_profile(state_profile&& other) noexcept
+    : calls_{other.calls_.load(std::memory_order_relaxed)}
+    , total_nanoseconds_{other.total_nanoseconds_.load(std::memory_order_relaxed)} {
+        for ( std::size_t i{}; i < errors_.size(); ++i ) {
+            errors_[i].store(other.errors_[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+
+        for ( std::size_t i{}; i < buckets_.size(); ++i ) {
+            buckets_[i].store(other.buckets_[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+    }
+
+    inline void state_profile::record_call(std::chrono::nanoseconds latency) noexcept {
+        const auto nanoseconds{static_cast<std::uint64_t>(std::max(latency.count(), std::int64_t{0}))};
+        const std::size_t bucket{std::min(static_cast<std::size_t>(std::bit_width(nanoseconds)), bucket_count - 1)};
+
+        calls_.fetch_add(1, std::memory_order_relaxed);
+        total_nanoseconds_.fetch_add(nanoseconds, std::memory_order_relaxed);
+        buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    inline void state_profile::record_error(error_code error) noexcept {
+        errors_[to_underlying(error)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    inline std::uint64_t state_profile::get_calls() const noexcept {
+        return calls_.load(std::memory_order_relaxed);
+    }
+
+    inline std::uint64_t state_profile::get_total_nanoseconds() const noexcept {
+        return total_nanoseconds_.load(std::memory_order_relaxed);
+    }
+
+    inline std::uint64_t state_profile::get_errors(error_code error) const noexcept {
+        return errors_[to_underlying(error)].load(std::memory_order_relaxed);
+    }
+
+    inline std::uint64_t state_profile::get_bucket(std::size_t bucket) const noexcept {
+        return bucket < buckets_.size() ? buckets_[bucket].load(std::memory_order_relaxed) : 0;
+    }
+
+    inline void state_profile::reset() noexcept {
+        calls_.store(0, std::memory_order_relaxed);
+        total_nanoseconds_.store(0, std::memory_order_relaxed);
+
+        for ( std::atomic<std::uint64_t>& errors : errors_ ) {
+            errors.store(0, std::memory_order_relaxed);
+        }
+
+        for ( std::atomic<std::uint64_t>& bucket : buckets_ ) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+#    define META_HPP_PROFILE_SCOPE(profile) \
+        const ::meta_hpp::detail::state_profile_scope META_HPP_PP_CAT(meta_hpp_profile_scope_, __LINE__) { profile }
+
+#    define META_HPP_PROFILE_RESULT(profile, ...) ::meta_hpp::detail::profile_result(profile, __VA_ARGS__)
+
+#else
+
+#    define META_HPP_PROFILE_SCOPE(profile) (void)0
+#    define META_HPP_PROFILE_RESULT(profile, ...) (__VA_ARGS__)
+
+#endif
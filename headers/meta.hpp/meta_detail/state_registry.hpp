@@ -39,36 +39,48 @@ namespace meta_hpp::detail
         template < typename F >
         // NOLINTNEXTLINE(*-missing-std-forward)
         void for_each_scope(F&& f) const {
-            const locker lock;
-
-            for ( auto&& [_, scope] : scopes_ ) {
-                std::invoke(f, scope);
-            }
+            // readers don't lock, they see all scopes resolved before the call
+            scopes_.for_each(f);
         }
 
         [[nodiscard]] scope get_scope_by_name(std::string_view name) const noexcept {
-            const locker lock;
-
-            if ( auto iter{scopes_.find(name)}; iter != scopes_.end() ) {
-                return iter->second;
+            if ( const std::size_t position{find_scope(name)}; position != published_index::npos ) {
+                return scopes_[position];
             }
 
             return scope{};
         }
 
+        [[nodiscard]] function get_function_by_name(std::string_view scope_name, std::string_view name) const noexcept {
+            if ( const std::size_t position{find_scope(scope_name)}; position != published_index::npos ) {
+                return scopes_[position].get_function(name);
+            }
+
+            return function{};
+        }
+
         [[nodiscard]] scope resolve_scope(std::string_view name) {
+            if ( const std::size_t position{find_scope(name)}; position != published_index::npos ) {
+                return scopes_[position];
+            }
+
             const locker lock;
 
-            if ( auto iter{scopes_.find(name)}; iter != scopes_.end() ) {
-                return iter->second;
+            if ( const std::size_t position{find_scope(name)}; position != published_index::npos ) {
+                return scopes_[position];
             }
 
-            auto&& [iter, _] = scopes_.emplace( //
-                std::string{name},
-                scope_state::make(std::string{name}, metadata_map{})
-            );
+            const scope& new_scope = scopes_.push_back(scope{scope_state::make(std::string{name}, metadata_map{})});
+            scope_names_.insert(std::hash<std::string_view>{}(name), scopes_.size() - 1);
 
-            return iter->second;
+            return new_scope;
+        }
+
+    private:
+        [[nodiscard]] std::size_t find_scope(std::string_view name) const noexcept {
+            return scope_names_.find(std::hash<std::string_view>{}(name), [this, name](std::size_t position) {
+                return scopes_[position].get_name() == name;
+            });
         }
 
     private:
@@ -76,6 +88,7 @@ namespace meta_hpp::detail
 
     private:
         std::recursive_mutex mutex_;
-        std::map<std::string, scope, std::less<>> scopes_;
+        published_list<scope> scopes_;
+        published_index scope_names_;
     };
 }
@@ -39,11 +39,8 @@ namespace meta_hpp::detail
         template < typename F >
         // NOLINTNEXTLINE(*-missing-std-forward)
         void for_each_type(F&& f) const {
-            const locker lock;
-
-            for ( auto&& type : types_ ) {
-                std::invoke(f, type);
-            }
+            // readers don't lock, they see all types registered before the call
+            types_.for_each(f);
         }
 
     public:
@@ -60,7 +57,8 @@ namespace meta_hpp::detail
                 auto new_data{std::make_unique<typename type_traits::data_type>(Traits{})};
 
                 const locker lock;
-                types_.emplace(new_data.get());
+                new_data->index = make_type_index(new_data->shared);
+                types_.push_back(any_type{new_data.get()});
 
                 return new_data;
             }();
@@ -71,8 +69,16 @@ namespace meta_hpp::detail
     private:
         type_registry() = default;
 
+        [[nodiscard]] std::size_t make_type_index(std::size_t shared) {
+            // types with equal shared hashes are the same type, so they
+            // share the index like they share the type identity
+            auto&& [iter, _] = type_indices_.try_emplace(shared, type_indices_.size() + 1);
+            return iter->second;
+        }
+
     private:
         std::recursive_mutex mutex_;
-        std::set<any_type, std::less<>> types_;
+        published_list<any_type> types_;
+        std::unordered_map<std::size_t, std::size_t> type_indices_;
     };
 }
@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "../meta_base.hpp"
+#include "../meta_types.hpp"
+
+namespace meta_hpp::detail
+{
+    // A per-thread direct-mapped cache of (derived, base) upcast lookups.
+    // Each thread fills its own cache, so lookups don't need any locking.
+    // Registration of a new class bumps a global generation that makes
+    // every thread drop its cached entries on the next lookup.
+
+    class upcast_cache final {
+    public:
+        using upcast_func_t = class_type_data::upcast_func_t;
+
+        struct stats_t final {
+            std::size_t hits{};
+            std::size_t misses{};
+        };
+
+        static constexpr std::size_t capacity{256};
+
+        [[nodiscard]] static upcast_cache& instance() noexcept {
+            thread_local upcast_cache instance;
+            return instance;
+        }
+
+        [[nodiscard]] const upcast_func_t* find_upcast(const class_type& from, const class_type& to) noexcept {
+            if ( const std::size_t generation{generation_counter().load(std::memory_order_acquire)}; generation_ != generation ) {
+                entries_.fill(entry_t{});
+                generation_ = generation;
+            }
+
+            const type_id from_id{from.get_id()};
+            const type_id to_id{to.get_id()};
+
+            // type indices are dense, so they are mixed just enough to spread
+            // (derived, base) pairs of close types. Indices are only unique per
+            // registry and every shared library may have its own one, so hits
+            // are confirmed by type identities.
+            entry_t& entry = entries_[(from_id.get_index() * 31 + to_id.get_index()) % capacity];
+
+            if ( entry.from_id == from_id && entry.to_id == to_id ) {
+                ++stats_.hits;
+                return entry.upcast;
+            }
+
+            ++stats_.misses;
+
+            entry.from_id = from_id;
+            entry.to_id = to_id;
+            entry.upcast = type_access(from)->find_upcast(to_id);
+
+            return entry.upcast;
+        }
+
+        [[nodiscard]] stats_t get_stats() const noexcept {
+            return stats_;
+        }
+
+        void reset_stats() noexcept {
+            stats_ = stats_t{};
+        }
+
+        static void invalidate() noexcept {
+            generation_counter().fetch_add(1, std::memory_order_release);
+        }
+
+    private:
+        upcast_cache() = default;
+
+        [[nodiscard]] static std::atomic<std::size_t>& generation_counter() noexcept {
+            static std::atomic<std::size_t> generation{};
+            return generation;
+        }
+
+    private:
+        struct entry_t final {
+            type_id from_id{};
+            type_id to_id{};
+            const upcast_func_t* upcast{};
+        };
+
+        std::size_t generation_{};
+        std::array<entry_t, capacity> entries_{};
+        stats_t stats_{};
+    };
+}
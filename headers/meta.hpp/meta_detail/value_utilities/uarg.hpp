@@ -10,6 +10,7 @@
 #include "../../meta_registry.hpp"
 #include "../../meta_uresult.hpp"
 #include "../../meta_uvalue.hpp"
+#include "../../meta_uvalue_ref.hpp"
 
 #include "utraits.hpp"
 
@@ -59,8 +60,9 @@ namespace meta_hpp::detail
         : ref_type_{std::is_const_v<std::remove_reference_t<T>> ? ref_types::const_rvalue : ref_types::rvalue}
         , raw_type_{registry.resolve_by_type<std::remove_cvref_t<T>>()} {}
 
+        // shared values are immutable, so they are passed as constant ones
         explicit uarg_base(type_registry&, uvalue& v)
-        : ref_type_{ref_types::lvalue}
+        : ref_type_{v.is_shared() ? ref_types::const_lvalue : ref_types::lvalue}
         , raw_type_{v.get_type()} {}
 
         explicit uarg_base(type_registry&, const uvalue& v)
@@ -69,7 +71,7 @@ namespace meta_hpp::detail
 
         // NOLINTNEXTLINE(*-param-not-moved)
         explicit uarg_base(type_registry&, uvalue&& v)
-        : ref_type_{ref_types::rvalue}
+        : ref_type_{v.is_shared() ? ref_types::const_rvalue : ref_types::rvalue}
         , raw_type_{v.get_type()} {}
 
         explicit uarg_base(type_registry&, const uvalue&& v)
@@ -81,6 +83,14 @@ namespace meta_hpp::detail
         explicit uarg_base(type_registry& registry, T&& v)
         : uarg_base{registry, *std::forward<T>(v)} {}
 
+        explicit uarg_base(type_registry&, const uvalue_ref& v)
+        : ref_type_{convert_ref_type<ref_types>(v.get_ref_type())}
+        , raw_type_{v.get_type()} {}
+
+        explicit uarg_base(ref_types ref_type, any_type raw_type) noexcept
+        : ref_type_{ref_type}
+        , raw_type_{raw_type} {}
+
         [[nodiscard]] bool is_ref_const() const noexcept {
             return ref_type_ == ref_types::const_lvalue //
                 || ref_type_ == ref_types::const_rvalue;
@@ -123,7 +133,7 @@ namespace meta_hpp::detail
             requires std::is_same_v<Tp, uvalue>
         explicit uarg(type_registry& registry, T&& v)
         : uarg_base{registry, std::forward<T>(v)}
-        , data_{const_cast<void*>(v.get_data())} { // NOLINT(*-const-cast)
+        , data_{const_cast<void*>(v.get_cdata())} { // NOLINT(*-const-cast)
             // there is no 'use after move' here because
             // 'uarg_base' doesn't actually move 'v', just gets its type
         }
@@ -132,11 +142,17 @@ namespace meta_hpp::detail
             requires std::is_same_v<Tp, uresult>
         explicit uarg(type_registry& registry, T&& v)
         : uarg_base{registry, std::forward<T>(v)}
-        , data_{const_cast<void*>(v->get_data())} { // NOLINT(*-const-cast)
+        , data_{const_cast<void*>(v->get_cdata())} { // NOLINT(*-const-cast)
             // there is no 'use after move' here because
             // 'uarg_base' doesn't actually move 'v', just gets its type
         }
 
+        template < typename T, typename Tp = std::decay_t<T> >
+            requires std::is_same_v<Tp, uvalue_ref>
+        explicit uarg(type_registry& registry, T&& v)
+        : uarg_base{registry, v}
+        , data_{const_cast<void*>(v.get_cdata())} {} // NOLINT(*-const-cast)
+
         template < typename T, typename Tp = std::decay_t<T> >
             requires(!uvalue_family<Tp>)
         explicit uarg(type_registry& registry, T&& v)
@@ -146,12 +162,26 @@ namespace meta_hpp::detail
             // 'uarg_base' doesn't actually move 'v', just gets its type
         }
 
+        explicit uarg(ref_types ref_type, any_type raw_type, void* data) noexcept
+        : uarg_base{ref_type, raw_type}
+        , data_{data} {}
+
         template < uarg_cast_to_pointer To >
         [[nodiscard]] decltype(auto) cast(type_registry& registry) const;
 
         template < uarg_cast_to_object To >
         [[nodiscard]] decltype(auto) cast(type_registry& registry) const;
 
+        template < uarg_cast_to_pointer To >
+        [[nodiscard]] decltype(auto) planned_cast() const;
+
+        template < uarg_cast_to_object To >
+        [[nodiscard]] decltype(auto) planned_cast() const;
+
+    private:
+        template < uarg_cast_to_object To >
+        [[nodiscard]] decltype(auto) cast_object(void* to_ptr) const;
+
     private:
         void* data_{};
     };
@@ -324,6 +354,24 @@ namespace meta_hpp::detail
         void* to_ptr = pointer_upcast(data_, from_type, to_type);
         META_HPP_ASSERT(to_ptr);
 
+        return cast_object<To>(to_ptr);
+    }
+
+    template < uarg_cast_to_pointer To >
+    [[nodiscard]] decltype(auto) uarg::planned_cast() const {
+        return static_cast<To>(*static_cast<void* const*>(data_));
+    }
+
+    template < uarg_cast_to_object To >
+    [[nodiscard]] decltype(auto) uarg::planned_cast() const {
+        return cast_object<To>(data_);
+    }
+
+    template < uarg_cast_to_object To >
+    [[nodiscard]] decltype(auto) uarg::cast_object(void* to_ptr) const {
+        using to_raw_type_cv = std::remove_reference_t<To>;
+        using to_raw_type = std::remove_cv_t<to_raw_type_cv>;
+
         if constexpr ( std::is_lvalue_reference_v<To> ) {
             return *static_cast<to_raw_type_cv*>(to_ptr);
         }
@@ -389,4 +437,129 @@ namespace meta_hpp::detail
             return std::invoke(META_HPP_FWD(captured_f), args[Is].cast<type_list_at_t<Is, ArgTypeList>>(registry)...);
         }(META_HPP_FWD(f), std::make_index_sequence<type_list_arity_v<ArgTypeList>>());
     }
+
+    template < typename ArgTypeList, typename F >
+    auto unchecked_call_with_planned_uargs(std::span<const uarg> args, F&& f) {
+        META_HPP_DEV_ASSERT(args.size() == type_list_arity_v<ArgTypeList>);
+        return [args]<std::size_t... Is>(auto&& captured_f, std::index_sequence<Is...>) {
+            return std::invoke(META_HPP_FWD(captured_f), args[Is].planned_cast<type_list_at_t<Is, ArgTypeList>>()...);
+        }(META_HPP_FWD(f), std::make_index_sequence<type_list_arity_v<ArgTypeList>>());
+    }
+}
+
+namespace meta_hpp::detail
+{
+    // Remembers how an argument of a known type reaches a parameter type.
+    // Upcasts are looked up once and applied to every passed argument, so
+    // a planned 'uarg' always points to a value of the parameter type and
+    // is cast by 'planned_cast' without any type checks.
+
+    class uarg_plan final {
+    public:
+        using upcast_func_t = class_type_data::upcast_func_t;
+
+        uarg_plan() = default;
+
+        template < typename T >
+        explicit uarg_plan(type_registry& registry, type_list<T>, const any_type& to_type);
+
+        template < typename T >
+        [[nodiscard]] uarg make_uarg(T&& arg, void*& pointer_slot) const noexcept;
+
+    private:
+        [[nodiscard]] static const upcast_func_t* find_upcast(const any_type& from, const any_type& to) noexcept;
+
+    private:
+        uarg_base::ref_types ref_type_{};
+        any_type raw_type_{};
+        bool to_pointer_{};
+        const upcast_func_t* upcast_{};
+    };
+}
+
+namespace meta_hpp::detail
+{
+    template < typename T >
+    uarg_plan::uarg_plan(type_registry& registry, type_list<T>, const any_type& to_type) {
+        const uarg_base from{registry, type_list<T>{}};
+
+        ref_type_ = from.get_ref_type();
+        raw_type_ = from.get_raw_type();
+        to_pointer_ = to_type.is_pointer();
+
+        if ( raw_type_.is_class() ) {
+            const any_type& to_raw_type = to_type.is_reference() //
+                                            ? to_type.as_reference().get_data_type()
+                                            : to_type;
+
+            if ( (upcast_ = find_upcast(raw_type_, to_raw_type)) ) {
+                raw_type_ = to_raw_type;
+            }
+        }
+
+        if ( to_pointer_ && (raw_type_.is_array() || raw_type_.is_pointer()) ) {
+            const any_type& from_data_type = raw_type_.is_array() //
+                                               ? raw_type_.as_array().get_data_type()
+                                               : raw_type_.as_pointer().get_data_type();
+
+            upcast_ = find_upcast(from_data_type, to_type.as_pointer().get_data_type());
+        }
+
+        if ( to_pointer_ ) {
+            raw_type_ = to_type;
+        }
+    }
+
+    template < typename T >
+    uarg uarg_plan::make_uarg(T&& arg, void*& pointer_slot) const noexcept {
+        using raw_type = std::remove_cvref_t<T>;
+
+        // NOLINTNEXTLINE(*-const-cast)
+        void* data{const_cast<raw_type*>(std::addressof(arg))};
+
+        if constexpr ( std::is_class_v<raw_type> ) {
+            if ( upcast_ != nullptr ) {
+                data = upcast_->apply(data);
+            }
+        }
+
+        // pointer parameters always get their pointer value through the slot
+
+        if constexpr ( std::is_array_v<raw_type> ) {
+            if ( to_pointer_ ) {
+                pointer_slot = upcast_ != nullptr ? upcast_->apply(data) : data;
+                data = &pointer_slot;
+            }
+        }
+
+        if constexpr ( std::is_pointer_v<raw_type> && !std::is_function_v<std::remove_pointer_t<raw_type>> ) {
+            if ( to_pointer_ ) {
+                // NOLINTNEXTLINE(*-const-cast)
+                void* ptr{const_cast<void*>(static_cast<const volatile void*>(arg))};
+                pointer_slot = upcast_ != nullptr && ptr != nullptr ? upcast_->apply(ptr) : ptr;
+                data = &pointer_slot;
+            }
+        }
+
+        if constexpr ( std::is_null_pointer_v<raw_type> ) {
+            if ( to_pointer_ ) {
+                pointer_slot = nullptr;
+                data = &pointer_slot;
+            }
+        }
+
+        return uarg{ref_type_, raw_type_, data};
+    }
+
+    inline const uarg_plan::upcast_func_t* uarg_plan::find_upcast(const any_type& from, const any_type& to) noexcept {
+        const class_type& from_class = from.as_class();
+        const class_type& to_class = to.as_class();
+
+        if ( !from_class || !to_class || from_class == to_class ) {
+            return nullptr;
+        }
+
+        const upcast_func_t* upcast = type_access(from_class)->find_upcast(to_class.get_id());
+        return upcast != nullptr && upcast->is_valid() ? upcast : nullptr;
+    }
 }
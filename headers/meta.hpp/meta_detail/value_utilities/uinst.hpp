@@ -10,6 +10,7 @@
 #include "../../meta_registry.hpp"
 #include "../../meta_uresult.hpp"
 #include "../../meta_uvalue.hpp"
+#include "../../meta_uvalue_ref.hpp"
 
 #include "utraits.hpp"
 
@@ -50,8 +51,9 @@ namespace meta_hpp::detail
         : ref_type_{std::is_const_v<std::remove_reference_t<T>> ? ref_types::const_rvalue : ref_types::rvalue}
         , raw_type_{registry.resolve_by_type<std::remove_cvref_t<T>>()} {}
 
+        // shared values are immutable, so they are passed as constant ones
         explicit uinst_base(type_registry&, uvalue& v)
-        : ref_type_{ref_types::lvalue}
+        : ref_type_{v.is_shared() ? ref_types::const_lvalue : ref_types::lvalue}
         , raw_type_{v.get_type()} {}
 
         explicit uinst_base(type_registry&, const uvalue& v)
@@ -60,7 +62,7 @@ namespace meta_hpp::detail
 
         // NOLINTNEXTLINE(*-param-not-moved)
         explicit uinst_base(type_registry&, uvalue&& v)
-        : ref_type_{ref_types::rvalue}
+        : ref_type_{v.is_shared() ? ref_types::const_rvalue : ref_types::rvalue}
         , raw_type_{v.get_type()} {}
 
         explicit uinst_base(type_registry&, const uvalue&& v)
@@ -72,6 +74,14 @@ namespace meta_hpp::detail
         explicit uinst_base(type_registry& registry, T&& v)
         : uinst_base{registry, *std::forward<T>(v)} {}
 
+        explicit uinst_base(type_registry&, const uvalue_ref& v)
+        : ref_type_{convert_ref_type<ref_types>(v.get_ref_type())}
+        , raw_type_{v.get_type()} {}
+
+        explicit uinst_base(ref_types ref_type, any_type raw_type) noexcept
+        : ref_type_{ref_type}
+        , raw_type_{raw_type} {}
+
         [[nodiscard]] bool is_inst_const() const noexcept {
             if ( raw_type_.is_pointer() ) {
                 const pointer_type& from_type_ptr = raw_type_.as_pointer();
@@ -116,7 +126,7 @@ namespace meta_hpp::detail
             requires std::is_same_v<Tp, uvalue>
         explicit uinst(type_registry& registry, T&& v)
         : uinst_base{registry, std::forward<T>(v)}
-        , data_{const_cast<void*>(v.get_data())} { // NOLINT(*-const-cast)
+        , data_{const_cast<void*>(v.get_cdata())} { // NOLINT(*-const-cast)
             // there is no 'use after move' here because
             // 'uinst_base' doesn't actually move 'v', just gets its type
         }
@@ -125,11 +135,17 @@ namespace meta_hpp::detail
             requires std::is_same_v<Tp, uresult>
         explicit uinst(type_registry& registry, T&& v)
         : uinst_base{registry, std::forward<T>(v)}
-        , data_{const_cast<void*>(v->get_data())} { // NOLINT(*-const-cast)
+        , data_{const_cast<void*>(v->get_cdata())} { // NOLINT(*-const-cast)
             // there is no 'use after move' here because
             // 'uinst_base' doesn't actually move 'v', just gets its type
         }
 
+        template < typename T, typename Tp = std::decay_t<T> >
+            requires std::is_same_v<Tp, uvalue_ref>
+        explicit uinst(type_registry& registry, T&& v)
+        : uinst_base{registry, v}
+        , data_{const_cast<void*>(v.get_cdata())} {} // NOLINT(*-const-cast)
+
         template < typename T, typename Tp = std::decay_t<T> >
             requires(!uvalue_family<Tp>)
         explicit uinst(type_registry& registry, T&& v)
@@ -139,9 +155,16 @@ namespace meta_hpp::detail
             // 'uinst_base' doesn't actually move 'v', just gets its type
         }
 
+        explicit uinst(ref_types ref_type, any_type raw_type, void* data) noexcept
+        : uinst_base{ref_type, raw_type}
+        , data_{data} {}
+
         template < inst_class_ref_kind Q >
         [[nodiscard]] decltype(auto) cast(type_registry& registry) const;
 
+        template < inst_class_ref_kind Q >
+        [[nodiscard]] decltype(auto) planned_cast() const;
+
     private:
         void* data_{};
     };
@@ -249,4 +272,157 @@ namespace meta_hpp::detail
 
         throw_exception(error_code::bad_instance_cast);
     }
+
+    template < inst_class_ref_kind Q >
+    decltype(auto) uinst::planned_cast() const {
+        using inst_class_cv = std::remove_reference_t<Q>;
+
+        META_HPP_ASSERT(data_ && "an attempt to call a method with a null instance");
+
+        if constexpr ( std::is_rvalue_reference_v<Q> ) {
+            return std::move(*static_cast<inst_class_cv*>(data_));
+        } else {
+            return *static_cast<inst_class_cv*>(data_);
+        }
+    }
+}
+
+namespace meta_hpp::detail
+{
+    // Remembers how an instance of a known type reaches the owner class of
+    // a method. A planned 'uinst' always points to an object of the owner
+    // class (pointer instances are planned as objects they point to) and
+    // is cast by 'planned_cast' without any type checks.
+
+    class uinst_plan final {
+    public:
+        using upcast_func_t = class_type_data::upcast_func_t;
+
+        uinst_plan() = default;
+
+        template < typename T >
+        explicit uinst_plan(type_registry& registry, type_list<T>, const class_type& to_type);
+
+        template < typename T >
+        [[nodiscard]] uinst make_uinst(T&& inst) const noexcept;
+        [[nodiscard]] uinst make_uinst_at(void* data) const noexcept;
+
+        [[nodiscard]] bool is_inst_const() const noexcept;
+
+    private:
+        uinst_base::ref_types ref_type_{};
+        any_type raw_type_{};
+        const upcast_func_t* upcast_{};
+    };
+}
+
+namespace meta_hpp::detail
+{
+    template < typename T >
+    uinst_plan::uinst_plan(type_registry& registry, type_list<T>, const class_type& to_type) {
+        const uinst_base from{registry, type_list<T>{}};
+
+        ref_type_ = from.get_ref_type();
+        raw_type_ = to_type;
+
+        if ( from.get_raw_type().is_pointer() ) {
+            ref_type_ = from.is_inst_const() ? uinst_base::ref_types::const_lvalue : uinst_base::ref_types::lvalue;
+        }
+
+        const class_type& from_class = from.get_raw_type().is_pointer() //
+                                         ? from.get_raw_type().as_pointer().get_data_type().as_class()
+                                         : from.get_raw_type().as_class();
+
+        if ( from_class && to_type && from_class != to_type ) {
+            upcast_ = type_access(from_class)->find_upcast(to_type.get_id());
+            upcast_ = upcast_ != nullptr && upcast_->is_valid() ? upcast_ : nullptr;
+        }
+    }
+
+    template < typename T >
+    uinst uinst_plan::make_uinst(T&& inst) const noexcept {
+        using raw_type = std::remove_cvref_t<T>;
+
+        void* data{};
+
+        if constexpr ( std::is_pointer_v<raw_type> ) {
+            // NOLINTNEXTLINE(*-const-cast)
+            data = const_cast<void*>(static_cast<const volatile void*>(inst));
+        } else {
+            // NOLINTNEXTLINE(*-const-cast)
+            data = const_cast<raw_type*>(std::addressof(inst));
+        }
+
+        return make_uinst_at(data);
+    }
+
+    inline uinst uinst_plan::make_uinst_at(void* data) const noexcept {
+        if ( upcast_ != nullptr && data != nullptr ) {
+            data = upcast_->apply(data);
+        }
+
+        return uinst{ref_type_, raw_type_, data};
+    }
+
+    inline bool uinst_plan::is_inst_const() const noexcept {
+        return ref_type_ == uinst_base::ref_types::const_lvalue //
+            || ref_type_ == uinst_base::ref_types::const_rvalue;
+    }
+}
+
+namespace meta_hpp::detail
+{
+    // A span of instances of the same static type planned by one plan.
+    // Instances are found by the stride of the span (pointer instances
+    // are read through), so the batch doesn't depend on their type.
+
+    class uinst_batch final {
+    public:
+        template < typename T >
+        explicit uinst_batch(const uinst_plan& plan, std::span<T> insts) noexcept;
+
+        [[nodiscard]] std::size_t size() const noexcept;
+        [[nodiscard]] bool is_inst_const() const noexcept;
+
+        [[nodiscard]] uinst operator[](std::size_t index) const noexcept;
+
+    private:
+        const uinst_plan* plan_{};
+        std::byte* first_{};
+        std::size_t size_{};
+        std::size_t stride_{};
+        bool indirect_{};
+    };
+}
+
+namespace meta_hpp::detail
+{
+    template < typename T >
+    uinst_batch::uinst_batch(const uinst_plan& plan, std::span<T> insts) noexcept
+    : plan_{&plan}
+    , first_{static_cast<std::byte*>(const_cast<void*>(static_cast<const volatile void*>(insts.data())))} // NOLINT(*-const-cast)
+    , size_{insts.size()}
+    , stride_{sizeof(T)}
+    , indirect_{std::is_pointer_v<std::remove_cv_t<T>>} {}
+
+    inline std::size_t uinst_batch::size() const noexcept {
+        return size_;
+    }
+
+    inline bool uinst_batch::is_inst_const() const noexcept {
+        return plan_->is_inst_const();
+    }
+
+    inline uinst uinst_batch::operator[](std::size_t index) const noexcept {
+        META_HPP_ASSERT(index < size_);
+
+        void* data = first_ + index * stride_;
+
+        if ( indirect_ ) {
+            // NOLINTNEXTLINE(*-const-cast)
+            data = const_cast<void*>(*static_cast<const volatile void* const*>(data));
+        }
+
+        return plan_->make_uinst_at(data);
+    }
 }
@@ -0,0 +1,66 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "../../meta_base.hpp"
+#include "../../meta_uvalue.hpp"
+
+namespace meta_hpp::detail
+{
+    // Sinks receive results of reflected calls. A call without a result
+    // (a void one or a discarded one) invokes a sink without arguments.
+
+    struct uvalue_usink final {
+        [[nodiscard]] uvalue operator()() const noexcept {
+            return uvalue{};
+        }
+
+        template < typename T >
+        [[nodiscard]] uvalue operator()(T&& val) const {
+            return uvalue{std::forward<T>(val)};
+        }
+    };
+
+    // Writes results to a target chosen at runtime: a reused uvalue slot,
+    // raw memory for a value of the result type, or nowhere at all. States
+    // write to raw memory only copies of their declared results, so the
+    // memory always has the return type without cv-qualifiers and references.
+
+    class target_usink final {
+    public:
+        target_usink() = default;
+
+        explicit target_usink(uvalue& slot) noexcept
+        : slot_{&slot} {}
+
+        explicit target_usink(void* mem) noexcept
+        : mem_{mem} {}
+
+        [[nodiscard]] bool is_memory() const noexcept {
+            return mem_ != nullptr;
+        }
+
+        void operator()() const noexcept {
+            if ( slot_ != nullptr ) {
+                slot_->reset();
+            }
+        }
+
+        template < typename T >
+        void operator()(T&& val) const {
+            if ( slot_ != nullptr ) {
+                slot_->assign(std::forward<T>(val));
+            } else if ( mem_ != nullptr ) {
+                std::construct_at(static_cast<std::decay_t<T>*>(mem_), std::forward<T>(val));
+            }
+        }
+
+    private:
+        uvalue* slot_{};
+        void* mem_{};
+    };
+}
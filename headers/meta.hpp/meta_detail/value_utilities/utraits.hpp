@@ -8,6 +8,9 @@
 
 #include "../../meta_base.hpp"
 #include "../../meta_registry.hpp"
+#include "../../meta_uvalue_ref.hpp"
+
+#include "../upcast_cache.hpp"
 
 namespace meta_hpp::detail
 {
@@ -22,6 +25,26 @@ namespace meta_hpp::detail
         &&(!std::is_reference_v<T> || std::is_rvalue_reference_v<T>);
 }
 
+namespace meta_hpp::detail
+{
+    template < typename RefTypes >
+    [[nodiscard]] RefTypes convert_ref_type(uvalue_ref::ref_types ref_type) noexcept {
+        switch ( ref_type ) {
+        case uvalue_ref::ref_types::lvalue:
+            return RefTypes::lvalue;
+        case uvalue_ref::ref_types::const_lvalue:
+            return RefTypes::const_lvalue;
+        case uvalue_ref::ref_types::rvalue:
+            return RefTypes::rvalue;
+        case uvalue_ref::ref_types::const_rvalue:
+            return RefTypes::const_rvalue;
+        }
+
+        META_HPP_ASSERT(false);
+        return RefTypes::const_lvalue;
+    }
+}
+
 namespace meta_hpp::detail
 {
     template < typename T >
@@ -106,14 +129,8 @@ namespace meta_hpp::detail
         const class_type& derived_class = derived.as_class();
 
         if ( base_class && derived_class ) {
-            const class_type_data& derived_data = *type_access(derived_class);
-            const class_type_data::deep_upcasts_t& deep_upcasts = derived_data.deep_upcasts;
-
-            for ( const auto& upcast : deep_upcasts ) {
-                if ( upcast.target == base_class ) {
-                    return upcast.upcast != nullptr;
-                }
-            }
+            const class_type_data::upcast_func_t* upcast = upcast_cache::instance().find_upcast(derived_class, base_class);
+            return upcast != nullptr && upcast->is_valid();
         }
 
         return false;
@@ -131,16 +148,8 @@ namespace meta_hpp::detail
             return ptr;
         }
 
-        const class_type_data& from_data = *type_access(from);
-        const class_type_data::deep_upcasts_t& deep_upcasts = from_data.deep_upcasts;
-
-        for ( const auto& upcast : deep_upcasts ) {
-            if ( upcast.target == to ) {
-                return upcast.upcast != nullptr ? upcast.apply(ptr) : nullptr;
-            }
-        }
-
-        return nullptr;
+        const class_type_data::upcast_func_t* upcast = upcast_cache::instance().find_upcast(from, to);
+        return upcast != nullptr && upcast->is_valid() ? upcast->apply(ptr) : nullptr;
     }
 
     [[nodiscard]] inline const void* pointer_upcast(const void* ptr, const class_type& from, const class_type& to) {
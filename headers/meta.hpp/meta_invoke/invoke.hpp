@@ -41,11 +41,10 @@ namespace meta_hpp
 
     template < function_pointer_kind Function, typename... Args >
     uresult try_invoke(Function function_ptr, Args&&... args) {
-        // doesn't actually move 'args', just checks conversion errors
-        if ( const uerror err = check_invocable_error(function_ptr, META_HPP_FWD(args)...) ) {
-            return err;
-        }
-        return invoke(function_ptr, META_HPP_FWD(args)...);
+        using namespace detail;
+        type_registry& registry{type_registry::instance()};
+        const std::array<uarg, sizeof...(Args)> vargs{uarg{registry, META_HPP_FWD(args)}...};
+        return raw_function_try_invoke<function_policy::as_copy_t>(registry, function_ptr, vargs);
     }
 
     template < typename Iter >
@@ -78,10 +77,20 @@ namespace meta_hpp
 
     template < function_pointer_kind Function, typename Iter >
     uresult try_invoke_variadic(Function function_ptr, Iter first, Iter last) {
-        if ( const uerror err = check_variadic_invocable_error(function_ptr, first, last) ) {
-            return err;
+        using namespace detail;
+        type_registry& registry{type_registry::instance()};
+
+        using ft = function_traits<std::remove_pointer_t<Function>>;
+        std::array<uarg, ft::arity> vargs;
+
+        for ( std::size_t count{}; first != last; ++count, ++first ) {
+            if ( count >= ft::arity ) {
+                return uerror{error_code::arity_mismatch};
+            }
+            vargs[count] = uarg{registry, *first};
         }
-        return invoke_variadic(function_ptr, first, last);
+
+        return raw_function_try_invoke<function_policy::as_copy_t>(registry, function_ptr, vargs);
     }
 }
 
@@ -107,11 +116,10 @@ namespace meta_hpp
 
     template < member_pointer_kind Member, typename Instance >
     uresult try_invoke(Member member_ptr, Instance&& instance) {
-        // doesn't actually move an 'instance', just checks conversion errors
-        if ( const uerror err = check_invocable_error(member_ptr, META_HPP_FWD(instance)) ) {
-            return err;
-        }
-        return invoke(member_ptr, META_HPP_FWD(instance));
+        using namespace detail;
+        type_registry& registry{type_registry::instance()};
+        const uinst vinst{registry, META_HPP_FWD(instance)};
+        return raw_member_try_getter<member_policy::as_copy_t>(registry, member_ptr, vinst);
     }
 }
 
@@ -138,11 +146,11 @@ namespace meta_hpp
 
     template < method_pointer_kind Method, typename Instance, typename... Args >
     uresult try_invoke(Method method_ptr, Instance&& instance, Args&&... args) {
-        // doesn't actually move an 'instance' and 'args', just checks conversion errors
-        if ( const uerror err = check_invocable_error(method_ptr, META_HPP_FWD(instance), META_HPP_FWD(args)...) ) {
-            return err;
-        }
-        return invoke(method_ptr, META_HPP_FWD(instance), META_HPP_FWD(args)...);
+        using namespace detail;
+        type_registry& registry{type_registry::instance()};
+        const uinst vinst{registry, META_HPP_FWD(instance)};
+        const std::array<uarg, sizeof...(Args)> vargs{uarg{registry, META_HPP_FWD(args)}...};
+        return raw_method_try_invoke<method_policy::as_copy_t>(registry, method_ptr, vinst, vargs);
     }
 
     template < typename Instance, typename Iter >
@@ -176,11 +184,21 @@ namespace meta_hpp
 
     template < method_pointer_kind Method, typename Instance, typename Iter >
     uresult try_invoke_variadic(Method method_ptr, Instance&& instance, Iter first, Iter last) {
-        // doesn't actually move an 'instance', just checks conversion errors
-        if ( const uerror err = check_variadic_invocable_error(method_ptr, META_HPP_FWD(instance), first, last) ) {
-            return err;
+        using namespace detail;
+        type_registry& registry{type_registry::instance()};
+
+        using mt = method_traits<Method>;
+        std::array<uarg, mt::arity> vargs;
+
+        for ( std::size_t count{}; first != last; ++count, ++first ) {
+            if ( count >= mt::arity ) {
+                return uerror{error_code::arity_mismatch};
+            }
+            vargs[count] = uarg{registry, *first};
         }
-        return invoke_variadic(method_ptr, META_HPP_FWD(instance), first, last);
+
+        const uinst vinst{registry, META_HPP_FWD(instance)};
+        return raw_method_try_invoke<method_policy::as_copy_t>(registry, method_ptr, vinst, vargs);
     }
 }
 
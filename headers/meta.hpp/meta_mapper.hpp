@@ -0,0 +1,53 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "meta_base.hpp"
+#include "meta_states.hpp"
+#include "meta_types.hpp"
+#include "meta_uresult.hpp"
+
+namespace meta_hpp::detail
+{
+    struct mapper_plan;
+}
+
+namespace meta_hpp
+{
+    class instance_mapper final {
+    public:
+        instance_mapper() = default;
+
+        explicit instance_mapper(const class_type& from, const class_type& to);
+
+        [[nodiscard]] bool is_valid() const noexcept;
+        [[nodiscard]] explicit operator bool() const noexcept;
+
+        [[nodiscard]] class_type get_from_type() const noexcept;
+        [[nodiscard]] class_type get_to_type() const noexcept;
+
+        [[nodiscard]] std::size_t get_mapped_count() const noexcept;
+        [[nodiscard]] std::size_t get_copy_count() const noexcept;
+
+        template < typename From, typename To >
+        uerror map(From&& from, To&& to) const;
+
+    private:
+        std::shared_ptr<const detail::mapper_plan> plan_;
+    };
+}
+
+namespace meta_hpp
+{
+    [[nodiscard]] instance_mapper resolve_mapper(const class_type& from, const class_type& to);
+
+    template < class_kind From, class_kind To >
+    [[nodiscard]] instance_mapper resolve_mapper();
+
+    template < typename From, typename To >
+    uerror map_instance(From&& from, To&& to);
+}
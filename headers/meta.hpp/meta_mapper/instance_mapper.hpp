@@ -0,0 +1,336 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "../meta_base.hpp"
+#include "../meta_mapper.hpp"
+#include "../meta_registry.hpp"
+
+#include "../meta_detail/type_registry.hpp"
+#include "../meta_detail/value_utilities/uarg.hpp"
+#include "../meta_detail/value_utilities/uinst.hpp"
+#include "../meta_states/member.hpp"
+#include "../meta_types/class_type.hpp"
+
+namespace meta_hpp::detail
+{
+    struct mapper_plan final {
+        using member_state_ptr = typename state_traits<member>::state_ptr;
+
+        // a run of trivially copyable fields laid out
+        // the same way in both classes, copied at once
+        struct copy_run final {
+            std::ptrdiff_t from_offset{};
+            std::ptrdiff_t to_offset{};
+            std::size_t size{};
+        };
+
+        struct field_step final {
+            member_state_ptr from_state;
+            member_state_ptr to_state;
+        };
+
+        class_type from_type;
+        class_type to_type;
+        std::size_t from_lookup_version{};
+        std::size_t to_lookup_version{};
+
+        std::vector<copy_run> copy_runs;
+        std::size_t copy_run_fields{};
+
+        // fields of the same type without a constant offset
+        std::vector<field_step> copy_steps;
+
+        // fields of different types, assigned through the member setter
+        std::vector<field_step> convert_steps;
+    };
+}
+
+namespace meta_hpp::detail
+{
+    [[nodiscard]] inline bool get_member_instance_offset(const class_type& owner, const member_state& state, std::ptrdiff_t& offset) {
+        if ( !state.has_offset ) {
+            return false;
+        }
+
+        const class_type& member_owner = state.index.get_type().get_owner_type();
+
+        if ( member_owner == owner ) {
+            offset = state.offset;
+            return true;
+        }
+
+        const class_type_data::upcast_func_t* upcast = type_access(owner)->find_upcast(member_owner.get_id());
+
+        if ( upcast == nullptr || !upcast->has_offset ) {
+            return false;
+        }
+
+        offset = upcast->offset + state.offset;
+        return true;
+    }
+
+    inline void add_mapper_field(mapper_plan& plan, const member& from_member, const member& to_member) {
+        const mapper_plan::member_state_ptr from_state = state_access(from_member);
+        const mapper_plan::member_state_ptr to_state = state_access(to_member);
+
+        const member_type& from_member_type = from_member.get_type();
+        const member_type& to_member_type = to_member.get_type();
+
+        // volatile fields have no address to read from
+        // and constant fields can't be assigned at all
+        if ( !from_state->address || to_member_type.get_flags().has(member_flags::is_readonly) ) {
+            return;
+        }
+
+        if ( from_member_type.get_value_type() == to_member_type.get_value_type() && to_state->address ) {
+            std::ptrdiff_t from_offset{};
+            std::ptrdiff_t to_offset{};
+
+            if ( to_state->is_trivially_copyable                                      //
+                 && get_member_instance_offset(plan.from_type, *from_state, from_offset) //
+                 && get_member_instance_offset(plan.to_type, *to_state, to_offset) ) {
+                plan.copy_runs.push_back({from_offset, to_offset, to_state->value_size});
+                return;
+            }
+
+            if ( to_state->is_trivially_copyable || to_state->raw_copy ) {
+                plan.copy_steps.push_back({from_state, to_state});
+                return;
+            }
+        }
+
+        const uinst_base vinst{uinst_base::ref_types::lvalue, plan.to_type};
+        const uarg_base vvalue{uarg_base::ref_types::const_lvalue, from_member_type.get_value_type()};
+
+        if ( !to_state->setter_error(vinst, vvalue) ) {
+            plan.convert_steps.push_back({from_state, to_state});
+        }
+    }
+
+    inline void coalesce_mapper_copy_runs(std::vector<mapper_plan::copy_run>& runs) {
+        using copy_run = mapper_plan::copy_run;
+
+        std::sort(runs.begin(), runs.end(), [](const copy_run& l, const copy_run& r) { //
+            return l.from_offset < r.from_offset;
+        });
+
+        // only adjacent fields are merged, any gap between them may hold
+        // another field of the destination that must not be overwritten
+        std::vector<copy_run> coalesced_runs;
+        for ( const copy_run& run : runs ) {
+            if ( !coalesced_runs.empty() ) {
+                copy_run& last = coalesced_runs.back();
+                const auto last_size{static_cast<std::ptrdiff_t>(last.size)};
+
+                if ( last.from_offset + last_size == run.from_offset && last.to_offset + last_size == run.to_offset ) {
+                    last.size += run.size;
+                    continue;
+                }
+            }
+            coalesced_runs.push_back(run);
+        }
+
+        runs.swap(coalesced_runs);
+    }
+
+    [[nodiscard]] inline std::shared_ptr<const mapper_plan> make_mapper_plan(const class_type& from, const class_type& to) {
+        auto plan{std::make_shared<mapper_plan>()};
+        plan->from_type = from;
+        plan->to_type = to;
+        plan->from_lookup_version = type_access(from)->get_flat_lookup_version();
+        plan->to_lookup_version = type_access(to)->get_flat_lookup_version();
+
+        // destination fields are visited in the same order as by member lookups,
+        // so a field hidden by a field of a derived class is never mapped
+        std::set<std::string_view> visited_names;
+        const auto visit_class = [&](const auto& self, const class_type& owner) -> void {
+            for ( const member& to_member : owner.get_members() ) {
+                if ( !visited_names.insert(to_member.get_name()).second ) {
+                    continue;
+                }
+
+                if ( const member& from_member = from.get_member(to_member.get_name()) ) {
+                    add_mapper_field(*plan, from_member, to_member);
+                }
+            }
+
+            const class_list& base_classes = owner.get_base_classes();
+            for ( auto iter{base_classes.rbegin()}, end{base_classes.rend()}; iter != end; ++iter ) {
+                self(self, *iter);
+            }
+        };
+
+        visit_class(visit_class, to);
+
+        plan->copy_run_fields = plan->copy_runs.size();
+        coalesce_mapper_copy_runs(plan->copy_runs);
+
+        return plan;
+    }
+
+    inline void run_mapper_plan(const mapper_plan& plan, const void* from_ptr, void* to_ptr) {
+        // NOLINTNEXTLINE(*-const-cast)
+        void* mutable_from_ptr{const_cast<void*>(from_ptr)};
+
+        for ( const mapper_plan::copy_run& run : plan.copy_runs ) {
+            std::memcpy( //
+                static_cast<std::byte*>(to_ptr) + run.to_offset,
+                static_cast<const std::byte*>(from_ptr) + run.from_offset,
+                run.size
+            );
+        }
+
+        for ( const mapper_plan::field_step& step : plan.copy_steps ) {
+            const void* from_field_ptr = get_member_raw_address(*step.from_state, mutable_from_ptr, plan.from_type);
+            void* to_field_ptr = get_member_raw_address(*step.to_state, to_ptr, plan.to_type);
+
+            if ( step.to_state->is_trivially_copyable ) {
+                std::memcpy(to_field_ptr, from_field_ptr, step.to_state->value_size);
+            } else {
+                step.to_state->raw_copy(to_field_ptr, from_field_ptr);
+            }
+        }
+
+        for ( const mapper_plan::field_step& step : plan.convert_steps ) {
+            void* from_field_ptr = get_member_raw_address(*step.from_state, mutable_from_ptr, plan.from_type);
+
+            const uinst vinst{uinst::ref_types::lvalue, plan.to_type, to_ptr};
+            const uarg vvalue{uarg::ref_types::const_lvalue, step.from_state->index.get_type().get_value_type(), from_field_ptr};
+
+            step.to_state->setter(vinst, vvalue);
+        }
+    }
+}
+
+namespace meta_hpp::detail
+{
+    class mapper_cache final {
+    public:
+        [[nodiscard]] static mapper_cache& instance() {
+            static mapper_cache instance;
+            return instance;
+        }
+
+        [[nodiscard]] std::shared_ptr<const mapper_plan> get_plan(const class_type& from, const class_type& to) {
+            const std::lock_guard lock{mutex_};
+
+            // a bind to one of the classes or their bases may add a field,
+            // so plans are rebuilt after the member lookups of either change
+            std::shared_ptr<const mapper_plan>& plan = plans_[std::make_pair(from.get_id(), to.get_id())];
+            if ( !plan || is_mapper_plan_outdated(*plan) ) {
+                plan = make_mapper_plan(from, to);
+            }
+
+            return plan;
+        }
+
+    private:
+        mapper_cache() = default;
+
+        [[nodiscard]] static bool is_mapper_plan_outdated(const mapper_plan& plan) noexcept {
+            return plan.from_lookup_version != type_access(plan.from_type)->get_flat_lookup_version()
+                || plan.to_lookup_version != type_access(plan.to_type)->get_flat_lookup_version();
+        }
+
+    private:
+        std::mutex mutex_;
+        std::map<std::pair<type_id, type_id>, std::shared_ptr<const mapper_plan>> plans_;
+    };
+}
+
+namespace meta_hpp
+{
+    inline instance_mapper::instance_mapper(const class_type& from, const class_type& to)
+    : plan_{from && to ? detail::mapper_cache::instance().get_plan(from, to) : nullptr} {}
+
+    inline bool instance_mapper::is_valid() const noexcept {
+        return plan_ != nullptr;
+    }
+
+    inline instance_mapper::operator bool() const noexcept {
+        return is_valid();
+    }
+
+    inline class_type instance_mapper::get_from_type() const noexcept {
+        return plan_ != nullptr ? plan_->from_type : class_type{};
+    }
+
+    inline class_type instance_mapper::get_to_type() const noexcept {
+        return plan_ != nullptr ? plan_->to_type : class_type{};
+    }
+
+    inline std::size_t instance_mapper::get_mapped_count() const noexcept {
+        if ( plan_ == nullptr ) {
+            return 0;
+        }
+
+        return plan_->copy_run_fields + plan_->copy_steps.size() + plan_->convert_steps.size();
+    }
+
+    inline std::size_t instance_mapper::get_copy_count() const noexcept {
+        return plan_ != nullptr ? plan_->copy_runs.size() : 0;
+    }
+
+    template < typename From, typename To >
+    uerror instance_mapper::map(From&& from, To&& to) const {
+        using namespace detail;
+        type_registry& registry{type_registry::instance()};
+
+        META_HPP_ASSERT(is_valid() && "an attempt to map with an invalid instance mapper");
+
+        auto* from_ptr = get_raw_instance_ptr(from);
+        auto* to_ptr = get_raw_instance_ptr(to);
+
+        using from_class_type = std::remove_cv_t<std::remove_pointer_t<decltype(from_ptr)>>;
+        using to_class_type = std::remove_cv_t<std::remove_pointer_t<decltype(to_ptr)>>;
+
+        static_assert(                                                     //
+            class_kind<from_class_type> && !uvalue_family<from_class_type> //
+            && class_kind<to_class_type> && !uvalue_family<to_class_type>  //
+            && "instance mapping requires typed class instances or pointers to them"
+        );
+
+        if constexpr ( std::is_const_v<std::remove_pointer_t<decltype(to_ptr)>> ) {
+            return uerror{error_code::bad_const_access};
+        } else {
+            const void* from_plan_ptr = pointer_upcast(from_ptr, registry.resolve_by_type<from_class_type>(), plan_->from_type);
+            void* to_plan_ptr = pointer_upcast(to_ptr, registry.resolve_by_type<to_class_type>(), plan_->to_type);
+
+            if ( from_plan_ptr == nullptr || to_plan_ptr == nullptr ) {
+                return uerror{error_code::bad_instance_cast};
+            }
+
+            run_mapper_plan(*plan_, from_plan_ptr, to_plan_ptr);
+            return uerror{error_code::no_error};
+        }
+    }
+}
+
+namespace meta_hpp
+{
+    inline instance_mapper resolve_mapper(const class_type& from, const class_type& to) {
+        return instance_mapper{from, to};
+    }
+
+    template < class_kind From, class_kind To >
+    instance_mapper resolve_mapper() {
+        using namespace detail;
+        type_registry& registry{type_registry::instance()};
+        return instance_mapper{registry.resolve_by_type<From>(), registry.resolve_by_type<To>()};
+    }
+
+    template < typename From, typename To >
+    uerror map_instance(From&& from, To&& to) {
+        using namespace detail;
+
+        using from_class_type = std::remove_cv_t<std::remove_pointer_t<decltype(get_raw_instance_ptr(from))>>;
+        using to_class_type = std::remove_cv_t<std::remove_pointer_t<decltype(get_raw_instance_ptr(to))>>;
+
+        return resolve_mapper<from_class_type, to_class_type>().map(META_HPP_FWD(from), META_HPP_FWD(to));
+    }
+}
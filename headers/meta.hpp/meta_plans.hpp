@@ -0,0 +1,133 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "meta_base.hpp"
+#include "meta_states.hpp"
+#include "meta_uresult.hpp"
+#include "meta_uvalue.hpp"
+
+#include "meta_detail/value_utilities/uarg.hpp"
+#include "meta_detail/value_utilities/uinst.hpp"
+
+namespace meta_hpp::detail
+{
+    template < typename T, typename Tp = std::decay_t<T> >
+    concept plan_arg_kind //
+        = (!uvalue_family<Tp>);
+
+    template < typename T, typename Tp = std::decay_t<T> >
+    concept plan_inst_kind     //
+        = (!uvalue_family<Tp>) //
+        &&(std::is_class_v<std::remove_pointer_t<std::remove_reference_t<T>>>);
+}
+
+namespace meta_hpp
+{
+    template < typename... Args >
+        requires(... && detail::plan_arg_kind<Args>)
+    class function_plan final {
+    public:
+        function_plan() = default;
+
+        explicit function_plan(function function);
+
+        [[nodiscard]] bool is_valid() const noexcept;
+        [[nodiscard]] explicit operator bool() const noexcept;
+
+        [[nodiscard]] const function& get_function() const noexcept;
+        [[nodiscard]] uerror get_error() const noexcept;
+
+        uvalue invoke(Args&&... args) const;
+        uvalue operator()(Args&&... args) const;
+
+    private:
+        function function_;
+        uerror error_;
+        std::array<detail::uarg_plan, sizeof...(Args)> args_{};
+    };
+
+    template < typename Instance, typename... Args >
+        requires detail::plan_inst_kind<Instance> && (... && detail::plan_arg_kind<Args>)
+    class method_plan final {
+    public:
+        method_plan() = default;
+
+        explicit method_plan(method method);
+
+        [[nodiscard]] bool is_valid() const noexcept;
+        [[nodiscard]] explicit operator bool() const noexcept;
+
+        [[nodiscard]] const method& get_method() const noexcept;
+        [[nodiscard]] uerror get_error() const noexcept;
+
+        uvalue invoke(Instance&& instance, Args&&... args) const;
+        uvalue operator()(Instance&& instance, Args&&... args) const;
+
+    private:
+        method method_;
+        uerror error_;
+        detail::uinst_plan inst_{};
+        std::array<detail::uarg_plan, sizeof...(Args)> args_{};
+    };
+}
+
+namespace meta_hpp
+{
+    template < typename R, typename... Args >
+    class typed_function<R(Args...)> final {
+    public:
+        using pointer_type = R (*)(Args...);
+
+        typed_function() = default;
+
+        explicit typed_function(pointer_type pointer) noexcept;
+
+        [[nodiscard]] bool is_valid() const noexcept;
+        [[nodiscard]] explicit operator bool() const noexcept;
+
+        [[nodiscard]] pointer_type get_pointer() const noexcept;
+
+        R invoke(Args... args) const;
+        R operator()(Args... args) const;
+
+    private:
+        pointer_type pointer_{};
+    };
+
+    template < typename R, typename Self, typename... Args >
+        requires std::is_reference_v<Self> && std::is_class_v<std::remove_reference_t<Self>>
+    class typed_method<R(Self, Args...)> final {
+    public:
+        using class_type = std::remove_cvref_t<Self>;
+
+        // any method pointer of the class is kept as this one and
+        // is converted back to its original type right before a call
+        using pointer_type = R (class_type::*)(Args...);
+
+        typed_method() = default;
+
+        template < detail::method_pointer_kind Method >
+        explicit typed_method(Method pointer) noexcept;
+
+        [[nodiscard]] bool is_valid() const noexcept;
+        [[nodiscard]] explicit operator bool() const noexcept;
+
+        R invoke(Self self, Args... args) const;
+        R operator()(Self self, Args... args) const;
+
+    private:
+        using thunk_type = R (*)(pointer_type, Self, Args...);
+
+        template < detail::method_pointer_kind Method >
+        static R thunk(pointer_type pointer, Self self, Args... args);
+
+    private:
+        pointer_type pointer_{};
+        thunk_type thunk_{};
+    };
+}
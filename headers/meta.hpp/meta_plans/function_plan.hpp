@@ -0,0 +1,89 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "../meta_base.hpp"
+#include "../meta_plans.hpp"
+#include "../meta_states.hpp"
+
+#include "../meta_detail/type_registry.hpp"
+#include "../meta_detail/value_utilities/uarg.hpp"
+#include "../meta_detail/value_utilities/usink.hpp"
+#include "../meta_states/function.hpp"
+
+namespace meta_hpp
+{
+    template < typename... Args >
+        requires(... && detail::plan_arg_kind<Args>)
+    function_plan<Args...>::function_plan(function function)
+    : function_{std::move(function)} {
+        using namespace detail;
+
+        if ( !function_ ) {
+            return;
+        }
+
+        if ( (error_ = function_.check_invocable_error<Args...>()) ) {
+            return;
+        }
+
+        type_registry& registry{type_registry::instance()};
+        const function_type& type = function_.get_type();
+
+        [this, &registry, &type]<std::size_t... Is>(std::index_sequence<Is...>) {
+            ((args_[Is] = uarg_plan{registry, type_list<Args>{}, type.get_argument_type(Is)}), ...);
+        }(std::make_index_sequence<sizeof...(Args)>());
+    }
+
+    template < typename... Args >
+        requires(... && detail::plan_arg_kind<Args>)
+    bool function_plan<Args...>::is_valid() const noexcept {
+        return function_.is_valid() && !error_;
+    }
+
+    template < typename... Args >
+        requires(... && detail::plan_arg_kind<Args>)
+    function_plan<Args...>::operator bool() const noexcept {
+        return is_valid();
+    }
+
+    template < typename... Args >
+        requires(... && detail::plan_arg_kind<Args>)
+    const function& function_plan<Args...>::get_function() const noexcept {
+        return function_;
+    }
+
+    template < typename... Args >
+        requires(... && detail::plan_arg_kind<Args>)
+    uerror function_plan<Args...>::get_error() const noexcept {
+        return error_;
+    }
+
+    template < typename... Args >
+        requires(... && detail::plan_arg_kind<Args>)
+    uvalue function_plan<Args...>::invoke(Args&&... args) const {
+        using namespace detail;
+
+        META_HPP_ASSERT(is_valid() && "an attempt to call an invalid function plan");
+
+        [[maybe_unused]] std::array<void*, sizeof...(Args)> pointer_slots{};
+
+        const std::array<uarg, sizeof...(Args)> vargs = [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            return std::array<uarg, sizeof...(Args)>{args_[Is].make_uarg(args, pointer_slots[Is])...};
+        }(std::make_index_sequence<sizeof...(Args)>());
+
+        uvalue result;
+        state_access(function_)->invoke_at(target_usink{result}, vargs, true);
+        return result;
+    }
+
+    template < typename... Args >
+        requires(... && detail::plan_arg_kind<Args>)
+    uvalue function_plan<Args...>::operator()(Args&&... args) const {
+        return invoke(META_HPP_FWD(args)...);
+    }
+}
@@ -0,0 +1,94 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "../meta_base.hpp"
+#include "../meta_plans.hpp"
+#include "../meta_states.hpp"
+
+#include "../meta_detail/type_registry.hpp"
+#include "../meta_detail/value_utilities/uarg.hpp"
+#include "../meta_detail/value_utilities/uinst.hpp"
+#include "../meta_detail/value_utilities/usink.hpp"
+#include "../meta_states/method.hpp"
+
+namespace meta_hpp
+{
+    template < typename Instance, typename... Args >
+        requires detail::plan_inst_kind<Instance> && (... && detail::plan_arg_kind<Args>)
+    method_plan<Instance, Args...>::method_plan(method method)
+    : method_{std::move(method)} {
+        using namespace detail;
+
+        if ( !method_ ) {
+            return;
+        }
+
+        if ( (error_ = method_.check_invocable_error<Instance, Args...>()) ) {
+            return;
+        }
+
+        type_registry& registry{type_registry::instance()};
+        const method_type& type = method_.get_type();
+
+        inst_ = uinst_plan{registry, type_list<Instance>{}, type.get_owner_type()};
+
+        [this, &registry, &type]<std::size_t... Is>(std::index_sequence<Is...>) {
+            ((args_[Is] = uarg_plan{registry, type_list<Args>{}, type.get_argument_type(Is)}), ...);
+        }(std::make_index_sequence<sizeof...(Args)>());
+    }
+
+    template < typename Instance, typename... Args >
+        requires detail::plan_inst_kind<Instance> && (... && detail::plan_arg_kind<Args>)
+    bool method_plan<Instance, Args...>::is_valid() const noexcept {
+        return method_.is_valid() && !error_;
+    }
+
+    template < typename Instance, typename... Args >
+        requires detail::plan_inst_kind<Instance> && (... && detail::plan_arg_kind<Args>)
+    method_plan<Instance, Args...>::operator bool() const noexcept {
+        return is_valid();
+    }
+
+    template < typename Instance, typename... Args >
+        requires detail::plan_inst_kind<Instance> && (... && detail::plan_arg_kind<Args>)
+    const method& method_plan<Instance, Args...>::get_method() const noexcept {
+        return method_;
+    }
+
+    template < typename Instance, typename... Args >
+        requires detail::plan_inst_kind<Instance> && (... && detail::plan_arg_kind<Args>)
+    uerror method_plan<Instance, Args...>::get_error() const noexcept {
+        return error_;
+    }
+
+    template < typename Instance, typename... Args >
+        requires detail::plan_inst_kind<Instance> && (... && detail::plan_arg_kind<Args>)
+    uvalue method_plan<Instance, Args...>::invoke(Instance&& instance, Args&&... args) const {
+        using namespace detail;
+
+        META_HPP_ASSERT(is_valid() && "an attempt to call an invalid method plan");
+
+        [[maybe_unused]] std::array<void*, sizeof...(Args)> pointer_slots{};
+
+        const uinst vinst = inst_.make_uinst(instance);
+
+        const std::array<uarg, sizeof...(Args)> vargs = [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            return std::array<uarg, sizeof...(Args)>{args_[Is].make_uarg(args, pointer_slots[Is])...};
+        }(std::make_index_sequence<sizeof...(Args)>());
+
+        uvalue result;
+        state_access(method_)->invoke_at(target_usink{result}, vinst, vargs, true);
+        return result;
+    }
+
+    template < typename Instance, typename... Args >
+        requires detail::plan_inst_kind<Instance> && (... && detail::plan_arg_kind<Args>)
+    uvalue method_plan<Instance, Args...>::operator()(Instance&& instance, Args&&... args) const {
+        return invoke(META_HPP_FWD(instance), META_HPP_FWD(args)...);
+    }
+}
@@ -0,0 +1,83 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "../meta_base.hpp"
+#include "../meta_plans.hpp"
+#include "../meta_registry.hpp"
+
+namespace meta_hpp::detail
+{
+    template < typename R, typename... Args >
+    bool is_typed_signature(type_registry& registry, const any_type& return_type, const any_type_list& argument_types) {
+        if ( return_type != registry.resolve_by_type<std::remove_cv_t<R>>() ) {
+            return false;
+        }
+
+        if ( argument_types.size() != sizeof...(Args) ) {
+            return false;
+        }
+
+        return [&registry, &argument_types]<std::size_t... Is>(std::index_sequence<Is...>) {
+            return (... && (argument_types[Is] == registry.resolve_by_type<std::remove_cv_t<Args>>()));
+        }(std::index_sequence_for<Args...>());
+    }
+
+    template < typename R, typename... Args >
+    typed_function<R(Args...)> make_typed_function(type_registry& registry, const function_state& state, type_list<R(Args...)>) {
+        const function_type& type = state.index.get_type();
+
+        if ( !is_typed_signature<R, Args...>(registry, type.get_return_type(), type.get_argument_types()) ) {
+            return typed_function<R(Args...)>{};
+        }
+
+        if ( type.get_flags().has(function_flags::is_noexcept) ) {
+            if ( const auto pointer = state.pointer.try_as<R (*)(Args...) noexcept>() ) {
+                return typed_function<R(Args...)>{pointer};
+            }
+        } else {
+            if ( const auto pointer = state.pointer.try_as<R (*)(Args...)>() ) {
+                return typed_function<R(Args...)>{pointer};
+            }
+        }
+
+        return typed_function<R(Args...)>{};
+    }
+}
+
+namespace meta_hpp
+{
+    template < typename R, typename... Args >
+    typed_function<R(Args...)>::typed_function(pointer_type pointer) noexcept
+    : pointer_{pointer} {}
+
+    template < typename R, typename... Args >
+    bool typed_function<R(Args...)>::is_valid() const noexcept {
+        return pointer_ != nullptr;
+    }
+
+    template < typename R, typename... Args >
+    typed_function<R(Args...)>::operator bool() const noexcept {
+        return is_valid();
+    }
+
+    template < typename R, typename... Args >
+    typename typed_function<R(Args...)>::pointer_type typed_function<R(Args...)>::get_pointer() const noexcept {
+        return pointer_;
+    }
+
+    template < typename R, typename... Args >
+    R typed_function<R(Args...)>::invoke(Args... args) const {
+        META_HPP_ASSERT(is_valid() && "an attempt to call an invalid typed function");
+        return pointer_(std::forward<Args>(args)...);
+    }
+
+    template < typename R, typename... Args >
+    R typed_function<R(Args...)>::operator()(Args... args) const {
+        return invoke(std::forward<Args>(args)...);
+    }
+}
@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "../meta_base.hpp"
+#include "../meta_plans.hpp"
+#include "../meta_registry.hpp"
+
+#include "typed_function.hpp"
+
+namespace meta_hpp::detail
+{
+    template < typename R, typename C, typename... Args >
+    using typed_method_pointers = type_list<
+        R (C::*)(Args...),
+        R (C::*)(Args...) noexcept,
+        R (C::*)(Args...) const,
+        R (C::*)(Args...) const noexcept,
+        R (C::*)(Args...) &,
+        R (C::*)(Args...) & noexcept,
+        R (C::*)(Args...) const&,
+        R (C::*)(Args...) const& noexcept,
+        R (C::*)(Args...) &&,
+        R (C::*)(Args...) && noexcept,
+        R (C::*)(Args...) const&&,
+        R (C::*)(Args...) const&& noexcept>;
+
+    template < typename R, typename Self, typename... Args >
+    typed_method<R(Self, Args...)> make_typed_method(type_registry& registry, const method_state& state, type_list<R(Self, Args...)>) {
+        using class_type = std::remove_cvref_t<Self>;
+        using pointers = typed_method_pointers<R, class_type, Args...>;
+
+        const method_type& type = state.index.get_type();
+
+        if ( type.get_owner_type() != registry.resolve_by_type<class_type>() ) {
+            return typed_method<R(Self, Args...)>{};
+        }
+
+        if ( !is_typed_signature<R, Args...>(registry, type.get_return_type(), type.get_argument_types()) ) {
+            return typed_method<R(Self, Args...)>{};
+        }
+
+        // only one of the pointer types has the same flags as the method
+        return [&state, flags = type.get_flags()]<std::size_t... Is>(std::index_sequence<Is...>) {
+            typed_method<R(Self, Args...)> result;
+
+            [[maybe_unused]] const auto try_pointer = [&state, &result, flags]<std::size_t I>(index_constant<I>) {
+                using pointer_type = type_list_at_t<I, pointers>;
+                if constexpr ( std::is_invocable_r_v<R, pointer_type, Self, Args...> ) {
+                    if ( method_traits<pointer_type>::make_flags() == flags ) {
+                        if ( const pointer_type pointer = state.pointer.try_as<pointer_type>() ) {
+                            result = typed_method<R(Self, Args...)>{pointer};
+                        }
+                    }
+                }
+            };
+
+            (try_pointer(index_constant<Is>{}), ...);
+            return result;
+        }(std::make_index_sequence<type_list_arity_v<pointers>>());
+    }
+}
+
+namespace meta_hpp
+{
+    template < typename R, typename Self, typename... Args >
+        requires std::is_reference_v<Self> && std::is_class_v<std::remove_reference_t<Self>>
+    template < detail::method_pointer_kind Method >
+    typed_method<R(Self, Args...)>::typed_method(Method pointer) noexcept
+    : pointer_{reinterpret_cast<pointer_type>(pointer)} // NOLINT(*-reinterpret-cast)
+    , thunk_{&thunk<Method>} {
+        static_assert(std::is_same_v<typename detail::method_traits<Method>::class_type, class_type>);
+        static_assert(std::is_invocable_r_v<R, Method, Self, Args...>);
+    }
+
+    template < typename R, typename Self, typename... Args >
+        requires std::is_reference_v<Self> && std::is_class_v<std::remove_reference_t<Self>>
+    bool typed_method<R(Self, Args...)>::is_valid() const noexcept {
+        return thunk_ != nullptr;
+    }
+
+    template < typename R, typename Self, typename... Args >
+        requires std::is_reference_v<Self> && std::is_class_v<std::remove_reference_t<Self>>
+    typed_method<R(Self, Args...)>::operator bool() const noexcept {
+        return is_valid();
+    }
+
+    template < typename R, typename Self, typename... Args >
+        requires std::is_reference_v<Self> && std::is_class_v<std::remove_reference_t<Self>>
+    R typed_method<R(Self, Args...)>::invoke(Self self, Args... args) const {
+        META_HPP_ASSERT(is_valid() && "an attempt to call an invalid typed method");
+        return thunk_(pointer_, std::forward<Self>(self), std::forward<Args>(args)...);
+    }
+
+    template < typename R, typename Self, typename... Args >
+        requires std::is_reference_v<Self> && std::is_class_v<std::remove_reference_t<Self>>
+    R typed_method<R(Self, Args...)>::operator()(Self self, Args... args) const {
+        return invoke(std::forward<Self>(self), std::forward<Args>(args)...);
+    }
+
+    template < typename R, typename Self, typename... Args >
+        requires std::is_reference_v<Self> && std::is_class_v<std::remove_reference_t<Self>>
+    template < detail::method_pointer_kind Method >
+    R typed_method<R(Self, Args...)>::thunk(pointer_type pointer, Self self, Args... args) {
+        const Method method_ptr{reinterpret_cast<Method>(pointer)}; // NOLINT(*-reinterpret-cast)
+        return (std::forward<Self>(self).*method_ptr)(std::forward<Args>(args)...);
+    }
+}
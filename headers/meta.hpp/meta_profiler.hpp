@@ -0,0 +1,78 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "meta_base.hpp"
+#include "meta_states.hpp"
+#include "meta_types.hpp"
+
+#include "meta_detail/state_profile.hpp"
+
+#if defined(META_HPP_WITH_PROFILER)
+
+namespace meta_hpp
+{
+    enum class profile_kind : std::uint8_t {
+        constructor,
+        function,
+        member_getter,
+        member_setter,
+        method,
+    };
+
+    class profile_stats final {
+    public:
+        static constexpr std::size_t bucket_count{detail::state_profile::bucket_count};
+
+        profile_stats() = default;
+        explicit profile_stats(const detail::state_profile& profile) noexcept;
+
+        [[nodiscard]] std::uint64_t get_calls() const noexcept;
+
+        [[nodiscard]] std::uint64_t get_failures() const noexcept;
+        [[nodiscard]] std::uint64_t get_failures(error_code error) const noexcept;
+
+        [[nodiscard]] std::chrono::nanoseconds get_total_time() const noexcept;
+        [[nodiscard]] std::chrono::nanoseconds get_mean_time() const noexcept;
+        [[nodiscard]] std::chrono::nanoseconds get_percentile_time(double percentile) const noexcept;
+
+        [[nodiscard]] std::span<const std::uint64_t> get_histogram() const noexcept;
+        [[nodiscard]] static std::chrono::nanoseconds get_bucket_upper_bound(std::size_t bucket) noexcept;
+
+    private:
+        std::uint64_t calls_{};
+        std::uint64_t total_nanoseconds_{};
+        std::array<std::uint64_t, detail::error_code_count> failures_{};
+        std::array<std::uint64_t, bucket_count> histogram_{};
+    };
+
+    struct profile_record final {
+        profile_kind kind{};
+
+        // the scope name for scope functions, the class type for class states
+        std::string scope_name{};
+        class_type owner_type{};
+
+        // the hash of the class type id, zero for scope functions
+        std::size_t owner_hash{};
+
+        // empty for constructors
+        std::string name{};
+
+        profile_stats stats{};
+    };
+
+    using profile_snapshot = std::vector<profile_record>;
+
+    [[nodiscard]] profile_snapshot take_profile_snapshot();
+    void reset_profile();
+
+    [[nodiscard]] std::string make_profile_report(const profile_snapshot& snapshot);
+    [[nodiscard]] std::string make_profile_json(const profile_snapshot& snapshot);
+}
+
+#endif
@@ -0,0 +1,318 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "../meta_base.hpp"
+#include "../meta_profiler.hpp"
+#include "../meta_registry.hpp"
+
+#include "../meta_states/constructor.hpp"
+#include "../meta_states/function.hpp"
+#include "../meta_states/member.hpp"
+#include "../meta_states/method.hpp"
+#include "../meta_states/scope.hpp"
+#include "../meta_types/class_type.hpp"
+
+#if defined(META_HPP_WITH_PROFILER)
+
+namespace meta_hpp::detail
+{
+    template < typename F >
+    void for_each_profile(F&& f) {
+        for_each_scope([&f](const scope& owner_scope) {
+            for ( const function& function : owner_scope.get_functions() ) {
+                f(profile_kind::function, owner_scope, class_type{}, function.get_name(), state_access(function)->profile);
+            }
+        });
+
+        for_each_type<class_type>([&f](const class_type& owner) {
+            for ( const constructor& constructor : owner.get_constructors() ) {
+                f(profile_kind::constructor, scope{}, owner, std::string{}, state_access(constructor)->profile);
+            }
+
+            for ( const function& function : owner.get_functions() ) {
+                f(profile_kind::function, scope{}, owner, function.get_name(), state_access(function)->profile);
+            }
+
+            for ( const member& member : owner.get_members() ) {
+                f(profile_kind::member_getter, scope{}, owner, member.get_name(), state_access(member)->getter_profile);
+                f(profile_kind::member_setter, scope{}, owner, member.get_name(), state_access(member)->setter_profile);
+            }
+
+            for ( const method& method : owner.get_methods() ) {
+                f(profile_kind::method, scope{}, owner, method.get_name(), state_access(method)->profile);
+            }
+        });
+    }
+
+    inline const char* get_profile_kind_name(profile_kind kind) noexcept {
+        switch ( kind ) {
+        case profile_kind::constructor:
+            return "constructor";
+        case profile_kind::function:
+            return "function";
+        case profile_kind::member_getter:
+            return "member_getter";
+        case profile_kind::member_setter:
+            return "member_setter";
+        case profile_kind::method:
+            return "method";
+        }
+
+        META_HPP_ASSERT(false);
+        return "unexpected profile kind";
+    }
+
+    inline std::string make_profile_label(const profile_record& record) {
+        constexpr std::string_view hex_digits{"0123456789abcdef"};
+
+        std::string label;
+        if ( record.owner_type ) {
+            // classes have no names, so they are labeled by the type id hash users can resolve
+            label.append("class@0x");
+            for ( std::size_t shift{sizeof(std::size_t) * 8}; shift > 0; shift -= 4 ) {
+                label.push_back(hex_digits[(record.owner_hash >> (shift - 4)) & 0x0FU]);
+            }
+        } else {
+            label.append(record.scope_name);
+        }
+
+        label += "::";
+        label += record.kind == profile_kind::constructor ? "<constructor>" : record.name;
+        return label;
+    }
+
+    inline void append_profile_column(std::string& out, std::string_view value, std::size_t width) {
+        out.append(width > value.size() ? width - value.size() : 0, ' ');
+        out.append(value);
+        out.append("  ");
+    }
+
+    inline void append_json_string(std::string& out, std::string_view value) {
+        constexpr std::string_view hex_digits{"0123456789abcdef"};
+
+        out.push_back('"');
+        for ( const char c : value ) {
+            switch ( c ) {
+            case '"':
+                out.append("\\\"");
+                break;
+            case '\\':
+                out.append("\\\\");
+                break;
+            case '\n':
+                out.append("\\n");
+                break;
+            case '\t':
+                out.append("\\t");
+                break;
+            default:
+                if ( static_cast<unsigned char>(c) < 0x20 ) {
+                    out.append("\\u00");
+                    out.push_back(hex_digits[(static_cast<unsigned char>(c) >> 4U) & 0x0FU]);
+                    out.push_back(hex_digits[static_cast<unsigned char>(c) & 0x0FU]);
+                } else {
+                    out.push_back(c);
+                }
+            }
+        }
+        out.push_back('"');
+    }
+}
+
+namespace meta_hpp
+{
+    inline profile_stats::profile_stats(const detail::state_profile& profile) noexcept
+    : calls_{profile.get_calls()}
+    , total_nanoseconds_{profile.get_total_nanoseconds()} {
+        for ( std::size_t i{}; i < failures_.size(); ++i ) {
+            failures_[i] = profile.get_errors(static_cast<error_code>(i));
+        }
+
+        for ( std::size_t i{}; i < histogram_.size(); ++i ) {
+            histogram_[i] = profile.get_bucket(i);
+        }
+    }
+
+    inline std::uint64_t profile_stats::get_calls() const noexcept {
+        return calls_;
+    }
+
+    inline std::uint64_t profile_stats::get_failures() const noexcept {
+        std::uint64_t failures{};
+        for ( const std::uint64_t errors : failures_ ) {
+            failures += errors;
+        }
+        return failures;
+    }
+
+    inline std::uint64_t profile_stats::get_failures(error_code error) const noexcept {
+        return failures_[detail::to_underlying(error)];
+    }
+
+    inline std::chrono::nanoseconds profile_stats::get_total_time() const noexcept {
+        return std::chrono::nanoseconds{total_nanoseconds_};
+    }
+
+    inline std::chrono::nanoseconds profile_stats::get_mean_time() const noexcept {
+        return std::chrono::nanoseconds{calls_ > 0 ? total_nanoseconds_ / calls_ : 0};
+    }
+
+    inline std::chrono::nanoseconds profile_stats::get_percentile_time(double percentile) const noexcept {
+        if ( calls_ == 0 ) {
+            return std::chrono::nanoseconds{0};
+        }
+
+        // the histogram is log-bucketed, so the result is an upper bound of the latency
+        const double clamped_percentile{std::clamp(percentile, 0.0, 1.0)};
+        const auto target{std::max(std::uint64_t{1}, static_cast<std::uint64_t>(clamped_percentile * static_cast<double>(calls_)))};
+
+        std::uint64_t calls{};
+        for ( std::size_t i{}; i < histogram_.size(); ++i ) {
+            if ( calls += histogram_[i]; calls >= target ) {
+                return get_bucket_upper_bound(i);
+            }
+        }
+
+        return get_bucket_upper_bound(histogram_.size() - 1);
+    }
+
+    inline std::span<const std::uint64_t> profile_stats::get_histogram() const noexcept {
+        return histogram_;
+    }
+
+    inline std::chrono::nanoseconds profile_stats::get_bucket_upper_bound(std::size_t bucket) noexcept {
+        return std::chrono::nanoseconds{bucket > 0 ? (std::int64_t{1} << std::min(bucket, bucket_count - 1)) : 0};
+    }
+}
+
+namespace meta_hpp
+{
+    inline profile_snapshot take_profile_snapshot() {
+        using namespace detail;
+
+        profile_snapshot snapshot;
+        for_each_profile([&snapshot](
+                             profile_kind kind,
+                             const scope& owner_scope,
+                             const class_type& owner_type,
+                             const std::string& name,
+                             const state_profile& profile
+                         ) {
+            // untouched states are skipped, a failed call is a call too
+            if ( profile.get_calls() == 0 ) {
+                return;
+            }
+
+            snapshot.push_back(profile_record{
+                .kind{kind},
+                .scope_name{owner_scope ? owner_scope.get_name() : std::string{}},
+                .owner_type{owner_type},
+                .owner_hash{owner_type ? owner_type.get_id().get_hash() : 0},
+                .name{name},
+                .stats{profile_stats{profile}},
+            });
+        });
+        return snapshot;
+    }
+
+    inline void reset_profile() {
+        using namespace detail;
+        for_each_profile([](profile_kind, const scope&, const class_type&, const std::string&, state_profile& profile) {
+            profile.reset();
+        });
+    }
+
+    inline std::string make_profile_report(const profile_snapshot& snapshot) {
+        using namespace detail;
+
+        std::vector<const profile_record*> records;
+        records.reserve(snapshot.size());
+        for ( const profile_record& record : snapshot ) {
+            records.push_back(&record);
+        }
+
+        std::stable_sort(records.begin(), records.end(), [](const profile_record* l, const profile_record* r) {
+            return l->stats.get_total_time() > r->stats.get_total_time();
+        });
+
+        std::string report;
+
+        append_profile_column(report, "calls", 12);
+        append_profile_column(report, "failures", 10);
+        append_profile_column(report, "total ns", 14);
+        append_profile_column(report, "mean ns", 10);
+        append_profile_column(report, "p50 ns", 10);
+        append_profile_column(report, "p99 ns", 10);
+        append_profile_column(report, "kind", 13);
+        report.append("state\n");
+
+        for ( const profile_record* record : records ) {
+            const profile_stats& stats = record->stats;
+            append_profile_column(report, std::to_string(stats.get_calls()), 12);
+            append_profile_column(report, std::to_string(stats.get_failures()), 10);
+            append_profile_column(report, std::to_string(stats.get_total_time().count()), 14);
+            append_profile_column(report, std::to_string(stats.get_mean_time().count()), 10);
+            append_profile_column(report, std::to_string(stats.get_percentile_time(0.5).count()), 10);
+            append_profile_column(report, std::to_string(stats.get_percentile_time(0.99).count()), 10);
+            append_profile_column(report, get_profile_kind_name(record->kind), 13);
+            report.append(make_profile_label(*record));
+            report.push_back('\n');
+        }
+
+        return report;
+    }
+
+    inline std::string make_profile_json(const profile_snapshot& snapshot) {
+        using namespace detail;
+
+        std::string json{"["};
+        for ( const profile_record& record : snapshot ) {
+            const profile_stats& stats = record.stats;
+
+            if ( json.size() > 1 ) {
+                json.push_back(',');
+            }
+
+            json.append("{\"kind\":");
+            append_json_string(json, get_profile_kind_name(record.kind));
+
+            json.append(",\"state\":");
+            append_json_string(json, make_profile_label(record));
+
+            json.append(",\"calls\":");
+            json.append(std::to_string(stats.get_calls()));
+
+            json.append(",\"failures\":{");
+            for ( std::size_t i{}, written{}; i < error_code_count; ++i ) {
+                const auto error{static_cast<error_code>(i)};
+                if ( const std::uint64_t failures{stats.get_failures(error)}; failures > 0 ) {
+                    json.append(written++ > 0 ? "," : "");
+                    append_json_string(json, get_error_code_message(error));
+                    json.push_back(':');
+                    json.append(std::to_string(failures));
+                }
+            }
+            json.push_back('}');
+
+            json.append(",\"total_ns\":");
+            json.append(std::to_string(stats.get_total_time().count()));
+
+            json.append(",\"histogram\":[");
+            for ( std::size_t i{}; i < stats.get_histogram().size(); ++i ) {
+                json.append(i > 0 ? "," : "");
+                json.append(std::to_string(stats.get_histogram()[i]));
+            }
+            json.append("]}");
+        }
+        json.push_back(']');
+
+        return json;
+    }
+}
+
+#endif
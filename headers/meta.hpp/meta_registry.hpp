@@ -72,4 +72,10 @@ namespace meta_hpp
         state_registry& registry = state_registry::instance();
         return registry.resolve_scope(name);
     }
+
+    inline function resolve_function(std::string_view scope_name, std::string_view name) {
+        using namespace detail;
+        state_registry& registry = state_registry::instance();
+        return registry.get_function_by_name(scope_name, name);
+    }
 }
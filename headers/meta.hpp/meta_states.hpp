@@ -15,6 +15,15 @@
 #include "meta_uvalue.hpp"
 
 #include "meta_detail/state_family.hpp"
+#include "meta_detail/state_profile.hpp"
+
+namespace meta_hpp::detail
+{
+    template < typename T >
+    concept uvalue_element_kind                            //
+        = std::is_same_v<std::remove_const_t<T>, uvalue>   //
+       || std::is_same_v<std::remove_const_t<T>, uvalue_ref>;
+}
 
 namespace meta_hpp
 {
@@ -105,6 +114,12 @@ namespace meta_hpp
         template < typename Iter >
         [[nodiscard]] uresult try_create_variadic(Iter first, Iter last) const;
 
+        template < detail::uvalue_element_kind T >
+        [[nodiscard]] uvalue create_variadic(std::span<T> args) const;
+
+        template < detail::uvalue_element_kind T >
+        [[nodiscard]] uresult try_create_variadic(std::span<T> args) const;
+
         template < typename Iter >
         uvalue create_variadic_at(void* mem, Iter first, Iter last) const;
 
@@ -174,6 +189,12 @@ namespace meta_hpp
         template < typename... Args >
         uvalue invoke(Args&&... args) const;
 
+        template < typename... Args >
+        void invoke_into(uvalue& result, Args&&... args) const;
+
+        template < typename... Args >
+        void invoke_into(void* mem, Args&&... args) const;
+
         template < typename... Args >
         uresult try_invoke(Args&&... args) const;
 
@@ -200,11 +221,22 @@ namespace meta_hpp
         template < typename Iter >
         uresult try_invoke_variadic(Iter first, Iter last) const;
 
+        template < detail::uvalue_element_kind T >
+        uvalue invoke_variadic(std::span<T> args) const;
+
+        template < detail::uvalue_element_kind T >
+        uresult try_invoke_variadic(std::span<T> args) const;
+
         template < typename Iter >
         [[nodiscard]] bool is_variadic_invocable_with(Iter first, Iter last) const;
 
         template < typename Iter >
         [[nodiscard]] uerror check_variadic_invocable_error(Iter first, Iter last) const;
+
+        //
+
+        template < typename Signature >
+        [[nodiscard]] typed_function<Signature> as_typed() const;
     };
 
     class member final : public state_base<member> {
@@ -223,6 +255,21 @@ namespace meta_hpp
         template < typename Instance >
         [[nodiscard]] uvalue operator()(Instance&& instance) const;
 
+        template < typename Instance >
+        uerror get_batch(std::span<Instance> instances, std::span<uvalue> results) const;
+
+        [[nodiscard]] bool has_offset() const noexcept;
+        [[nodiscard]] std::ptrdiff_t get_offset() const noexcept;
+
+        template < typename T, typename Instance >
+        [[nodiscard]] T& get_ref(Instance&& instance) const;
+
+        template < typename Instance >
+        uerror read_raw(Instance&& instance, void* out) const;
+
+        template < typename Instance >
+        uerror write_raw(Instance&& instance, const void* in) const;
+
         template < typename Instance, typename Value >
         void set(Instance&& instance, Value&& value) const;
 
@@ -273,9 +320,21 @@ namespace meta_hpp
         template < typename Instance, typename... Args >
         uvalue invoke(Instance&& instance, Args&&... args) const;
 
+        template < typename Instance, typename... Args >
+        void invoke_into(uvalue& result, Instance&& instance, Args&&... args) const;
+
+        template < typename Instance, typename... Args >
+        void invoke_into(void* mem, Instance&& instance, Args&&... args) const;
+
         template < typename Instance, typename... Args >
         uresult try_invoke(Instance&& instance, Args&&... args) const;
 
+        template < typename Instance, typename... Args >
+        uerror invoke_batch(std::span<Instance> instances, Args&&... args) const;
+
+        template < typename Instance, typename... Args >
+        uerror invoke_batch(std::span<Instance> instances, std::span<uvalue> results, Args&&... args) const;
+
         template < typename Instance, typename... Args >
         uvalue operator()(Instance&& instance, Args&&... args) const;
 
@@ -299,11 +358,22 @@ namespace meta_hpp
         template < typename Instance, typename Iter >
         uresult try_invoke_variadic(Instance&& instance, Iter first, Iter last) const;
 
+        template < typename Instance, detail::uvalue_element_kind T >
+        uvalue invoke_variadic(Instance&& instance, std::span<T> args) const;
+
+        template < typename Instance, detail::uvalue_element_kind T >
+        uresult try_invoke_variadic(Instance&& instance, std::span<T> args) const;
+
         template < typename Instance, typename Iter >
         [[nodiscard]] bool is_variadic_invocable_with(Instance&& instance, Iter first, Iter last) const;
 
         template < typename Instance, typename Iter >
         [[nodiscard]] uerror check_variadic_invocable_error(Instance&& instance, Iter first, Iter last) const;
+
+        //
+
+        template < typename Signature >
+        [[nodiscard]] typed_method<Signature> as_typed() const;
     };
 
     class scope final : public state_base<scope> {
@@ -436,6 +506,8 @@ namespace meta_hpp::detail
     struct constructor_state final : private state_traits<constructor> {
         using create_impl = fixed_function<uvalue(std::span<const uarg>)>;
         using create_at_impl = fixed_function<uvalue(void*, std::span<const uarg>)>;
+        using try_create_impl = fixed_function<uresult(std::span<const uarg>)>;
+        using try_create_at_impl = fixed_function<uresult(void*, std::span<const uarg>)>;
         using create_error_impl = fixed_function<uerror(std::span<const uarg_base>)>;
 
         constructor_index index;
@@ -443,9 +515,15 @@ namespace meta_hpp::detail
 
         create_impl create{};
         create_at_impl create_at{};
+        try_create_impl try_create{};
+        try_create_at_impl try_create_at{};
         create_error_impl create_error{};
         argument_list arguments{};
 
+#if defined(META_HPP_WITH_PROFILER)
+        state_profile profile{};
+#endif
+
         template < constructor_policy_family Policy, class_kind Class, typename... Args >
         [[nodiscard]] static state_ptr make(metadata_map metadata);
         explicit constructor_state(constructor_index index, metadata_map metadata);
@@ -491,15 +569,27 @@ namespace meta_hpp::detail
 
     struct function_state final : private state_traits<function> {
         using invoke_impl = fixed_function<uvalue(std::span<const uarg>)>;
+        using invoke_at_impl = fixed_function<void(const target_usink&, std::span<const uarg>, bool)>;
+        using try_invoke_impl = fixed_function<uresult(std::span<const uarg>)>;
         using invoke_error_impl = fixed_function<uerror(std::span<const uarg_base>)>;
 
         function_index index;
         metadata_map metadata;
 
+        // 'invoke_at' serves every other kind of call: it writes the result
+        // to the given target and casts planned arguments without checks
         invoke_impl invoke{};
+        invoke_at_impl invoke_at{};
+        try_invoke_impl try_invoke{};
         invoke_error_impl invoke_error{};
         argument_list arguments{};
 
+        uvalue pointer{};
+
+#if defined(META_HPP_WITH_PROFILER)
+        state_profile profile{};
+#endif
+
         template < function_policy_family Policy, function_pointer_kind Function >
         [[nodiscard]] static state_ptr make(std::string name, Function function_ptr, metadata_map metadata);
         explicit function_state(function_index index, metadata_map metadata);
@@ -512,17 +602,42 @@ namespace meta_hpp::detail
         using getter_impl = fixed_function<uvalue(const uinst&)>;
         using setter_impl = fixed_function<void(const uinst&, const uarg&)>;
 
+        using try_getter_impl = fixed_function<uresult(const uinst&)>;
+        using try_setter_impl = fixed_function<uerror(const uinst&, const uarg&)>;
+
+        using getter_at_impl = fixed_function<void(const target_usink&, const uinst&, bool)>;
+
         using getter_error_impl = fixed_function<uerror(const uinst_base&)>;
         using setter_error_impl = fixed_function<uerror(const uinst_base&, const uarg_base&)>;
 
+        using address_impl = fixed_function<void*(void*)>;
+        using raw_copy_impl = fixed_function<void(void*, const void*)>;
+
         member_index index;
         metadata_map metadata;
 
         getter_impl getter{};
         setter_impl setter{};
+        try_getter_impl try_getter{};
+        try_setter_impl try_setter{};
+        getter_at_impl getter_at{};
         getter_error_impl getter_error{};
         setter_error_impl setter_error{};
 
+        // raw access, the offset is known for members of standard-layout
+        // classes, other members are addressed through the member pointer
+        address_impl address{};
+        raw_copy_impl raw_copy{};
+        std::ptrdiff_t offset{};
+        std::size_t value_size{};
+        bool has_offset{};
+        bool is_trivially_copyable{};
+
+#if defined(META_HPP_WITH_PROFILER)
+        state_profile getter_profile{};
+        state_profile setter_profile{};
+#endif
+
         template < member_policy_family Policy, member_pointer_kind Member >
         [[nodiscard]] static state_ptr make(std::string name, Member member_ptr, metadata_map metadata);
         explicit member_state(member_index index, metadata_map metadata);
@@ -533,15 +648,26 @@ namespace meta_hpp::detail
 
     struct method_state final : private state_traits<method> {
         using invoke_impl = fixed_function<uvalue(const uinst&, std::span<const uarg>)>;
+        using invoke_at_impl = fixed_function<void(const target_usink&, const uinst&, std::span<const uarg>, bool)>;
+        using try_invoke_impl = fixed_function<uresult(const uinst&, std::span<const uarg>)>;
         using invoke_error_impl = fixed_function<uerror(const uinst_base&, std::span<const uarg_base>)>;
 
         method_index index;
         metadata_map metadata;
 
+        // 'invoke_at' serves every other kind of call, see 'function_state'
         invoke_impl invoke{};
+        invoke_at_impl invoke_at{};
+        try_invoke_impl try_invoke{};
         invoke_error_impl invoke_error{};
         argument_list arguments{};
 
+        uvalue pointer{};
+
+#if defined(META_HPP_WITH_PROFILER)
+        state_profile profile{};
+#endif
+
         template < method_policy_family Policy, method_pointer_kind Method >
         [[nodiscard]] static state_ptr make(std::string name, Method method_ptr, metadata_map metadata);
         explicit method_state(method_index index, metadata_map metadata);
@@ -558,6 +684,11 @@ namespace meta_hpp::detail
         typedef_map typedefs{};
         variable_list variables{};
 
+        name_index function_names{};
+        name_index variable_names{};
+
+        signature_index function_signatures{};
+
         [[nodiscard]] static state_ptr make(std::string name, metadata_map metadata);
         explicit scope_state(scope_index index, metadata_map metadata);
 
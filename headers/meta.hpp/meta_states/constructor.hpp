@@ -16,7 +16,7 @@
 namespace meta_hpp::detail
 {
     template < constructor_policy_family Policy, class_kind Class, typename... Args >
-    uvalue raw_constructor_create(type_registry& registry, std::span<const uarg> args) {
+    uvalue raw_constructor_unchecked_create(type_registry& registry, std::span<const uarg> args) {
         using ct = constructor_traits<Class, Args...>;
         using class_type = typename ct::class_type;
         using argument_types = typename ct::argument_types;
@@ -35,16 +35,6 @@ namespace meta_hpp::detail
 
         static_assert(as_object || as_raw_ptr || as_shared_ptr || as_unique_ptr);
 
-        META_HPP_ASSERT(             //
-            args.size() == ct::arity //
-            && "an attempt to call a constructor with an incorrect arity"
-        );
-
-        META_HPP_ASSERT(                                       //
-            can_cast_all_uargs<argument_types>(registry, args) //
-            && "an attempt to call a constructor with incorrect argument types"
-        );
-
         return unchecked_call_with_uargs<argument_types>(registry, args, [](auto&&... all_args) -> uvalue {
             if constexpr ( as_object ) {
                 return make_uvalue<class_type>(META_HPP_FWD(all_args)...);
@@ -64,6 +54,40 @@ namespace meta_hpp::detail
         });
     }
 
+    template < constructor_policy_family Policy, class_kind Class, typename... Args >
+    uvalue raw_constructor_create(type_registry& registry, std::span<const uarg> args) {
+        using ct = constructor_traits<Class, Args...>;
+        using argument_types = typename ct::argument_types;
+
+        META_HPP_ASSERT(             //
+            args.size() == ct::arity //
+            && "an attempt to call a constructor with an incorrect arity"
+        );
+
+        META_HPP_ASSERT(                                       //
+            can_cast_all_uargs<argument_types>(registry, args) //
+            && "an attempt to call a constructor with incorrect argument types"
+        );
+
+        return raw_constructor_unchecked_create<Policy, Class, Args...>(registry, args);
+    }
+
+    template < constructor_policy_family Policy, class_kind Class, typename... Args >
+    uresult raw_constructor_try_create(type_registry& registry, std::span<const uarg> args) {
+        using ct = constructor_traits<Class, Args...>;
+        using argument_types = typename ct::argument_types;
+
+        if ( args.size() != ct::arity ) {
+            return uerror{error_code::arity_mismatch};
+        }
+
+        if ( !can_cast_all_uargs<argument_types>(registry, args) ) {
+            return uerror{error_code::argument_type_mismatch};
+        }
+
+        return raw_constructor_unchecked_create<Policy, Class, Args...>(registry, args);
+    }
+
     template < class_kind Class, typename... Args >
     uvalue raw_constructor_create_at(type_registry& registry, void* mem, std::span<const uarg> args) {
         using ct = constructor_traits<Class, Args...>;
@@ -85,6 +109,25 @@ namespace meta_hpp::detail
         });
     }
 
+    template < class_kind Class, typename... Args >
+    uresult raw_constructor_try_create_at(type_registry& registry, void* mem, std::span<const uarg> args) {
+        using ct = constructor_traits<Class, Args...>;
+        using class_type = typename ct::class_type;
+        using argument_types = typename ct::argument_types;
+
+        if ( args.size() != ct::arity ) {
+            return uerror{error_code::arity_mismatch};
+        }
+
+        if ( !can_cast_all_uargs<argument_types>(registry, args) ) {
+            return uerror{error_code::argument_type_mismatch};
+        }
+
+        return unchecked_call_with_uargs<argument_types>(registry, args, [mem](auto&&... all_args) {
+            return std::construct_at(static_cast<class_type*>(mem), META_HPP_FWD(all_args)...);
+        });
+    }
+
     template < class_kind Class, typename... Args >
     uerror raw_constructor_create_error(type_registry& registry, std::span<const uarg_base> args) noexcept {
         using ct = constructor_traits<Class, Args...>;
@@ -111,6 +154,13 @@ namespace meta_hpp::detail
         };
     }
 
+    template < constructor_policy_family Policy, class_kind Class, typename... Args >
+    constructor_state::try_create_impl make_constructor_try_create(type_registry& registry) {
+        return [&registry](std::span<const uarg> args) { //
+            return raw_constructor_try_create<Policy, Class, Args...>(registry, args);
+        };
+    }
+
     template < class_kind Class, typename... Args >
     constructor_state::create_at_impl make_constructor_create_at(type_registry& registry) {
         return [&registry](void* mem, std::span<const uarg> args) { //
@@ -118,6 +168,13 @@ namespace meta_hpp::detail
         };
     }
 
+    template < class_kind Class, typename... Args >
+    constructor_state::try_create_at_impl make_constructor_try_create_at(type_registry& registry) {
+        return [&registry](void* mem, std::span<const uarg> args) { //
+            return raw_constructor_try_create_at<Class, Args...>(registry, mem, args);
+        };
+    }
+
     template < class_kind Class, typename... Args >
     constructor_state::create_error_impl make_constructor_create_error(type_registry& registry) {
         return [&registry](std::span<const uarg_base> args) { //
@@ -158,6 +215,8 @@ namespace meta_hpp::detail
 
         state.create = make_constructor_create<Policy, Class, Args...>(registry);
         state.create_at = make_constructor_create_at<Class, Args...>(registry);
+        state.try_create = make_constructor_try_create<Policy, Class, Args...>(registry);
+        state.try_create_at = make_constructor_try_create_at<Class, Args...>(registry);
         state.create_error = make_constructor_create_error<Class, Args...>(registry);
         state.arguments = make_constructor_arguments<Class, Args...>();
 
@@ -200,6 +259,7 @@ namespace meta_hpp
     template < typename... Args >
     uvalue constructor::create(Args&&... args) const {
         using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
         type_registry& registry{type_registry::instance()};
         const std::array<uarg, sizeof...(Args)> vargs{uarg{registry, META_HPP_FWD(args)}...};
         return state_->create(vargs);
@@ -207,16 +267,17 @@ namespace meta_hpp
 
     template < typename... Args >
     uresult constructor::try_create(Args&&... args) const {
-        // doesn't actually move 'args', just checks conversion errors
-        if ( const uerror err = check_invocable_error(META_HPP_FWD(args)...) ) {
-            return err;
-        }
-        return create(META_HPP_FWD(args)...);
+        using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
+        type_registry& registry{type_registry::instance()};
+        const std::array<uarg, sizeof...(Args)> vargs{uarg{registry, META_HPP_FWD(args)}...};
+        return META_HPP_PROFILE_RESULT(state_->profile, state_->try_create(vargs));
     }
 
     template < typename... Args >
     uvalue constructor::create_at(void* mem, Args&&... args) const {
         using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
         type_registry& registry{type_registry::instance()};
         const std::array<uarg, sizeof...(Args)> vargs{uarg{registry, META_HPP_FWD(args)}...};
         return state_->create_at(mem, vargs);
@@ -224,11 +285,11 @@ namespace meta_hpp
 
     template < typename... Args >
     uresult constructor::try_create_at(void* mem, Args&&... args) const {
-        // doesn't actually move 'args', just checks conversion errors
-        if ( const uerror err = check_invocable_error(META_HPP_FWD(args)...) ) {
-            return err;
-        }
-        return create_at(mem, META_HPP_FWD(args)...);
+        using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
+        type_registry& registry{type_registry::instance()};
+        const std::array<uarg, sizeof...(Args)> vargs{uarg{registry, META_HPP_FWD(args)}...};
+        return META_HPP_PROFILE_RESULT(state_->profile, state_->try_create_at(mem, vargs));
     }
 
     template < typename... Args >
@@ -260,16 +321,12 @@ namespace meta_hpp
     template < typename Iter >
     uvalue constructor::create_variadic(Iter first, Iter last) const {
         using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
 
         const std::size_t arity = get_arity();
         type_registry& registry{type_registry::instance()};
 
-        META_HPP_DETAIL_IGNORE_ALLOCA_WARNINGS_PUSH()
-
-        void* vargs_mem = META_HPP_ALLOCA(sizeof(uarg) * arity);
-        detail::inline_vector<uarg> vargs{static_cast<uarg*>(vargs_mem), arity};
-
-        META_HPP_DETAIL_IGNORE_ALLOCA_WARNINGS_POP()
+        detail::small_vector<uarg, META_HPP_VARIADIC_INLINE_ARITY> vargs{arity};
 
         for ( std::size_t i{}; first != last; ++i, ++first ) {
             if ( i >= arity ) {
@@ -283,25 +340,73 @@ namespace meta_hpp
 
     template < typename Iter >
     uresult constructor::try_create_variadic(Iter first, Iter last) const {
-        if ( const uerror err = check_variadic_invocable_error(first, last) ) {
-            return err;
+        using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
+
+        const std::size_t arity = get_arity();
+        type_registry& registry{type_registry::instance()};
+
+        detail::small_vector<uarg, META_HPP_VARIADIC_INLINE_ARITY> vargs{arity};
+
+        for ( std::size_t i{}; first != last; ++i, ++first ) {
+            if ( i >= arity ) {
+                return META_HPP_PROFILE_RESULT(state_->profile, uerror(error_code::arity_mismatch));
+            }
+            vargs.emplace_back(registry, *first);
+        }
+
+        return META_HPP_PROFILE_RESULT(state_->profile, state_->try_create({vargs.begin(), vargs.end()}));
+    }
+
+    template < detail::uvalue_element_kind T >
+    uvalue constructor::create_variadic(std::span<T> args) const {
+        using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
+
+        if ( args.size() != get_arity() ) {
+            throw_exception(error_code::arity_mismatch);
+        }
+
+        type_registry& registry{type_registry::instance()};
+
+        detail::small_vector<uarg, META_HPP_VARIADIC_INLINE_ARITY> vargs{args.size()};
+
+        for ( T& arg : args ) {
+            vargs.emplace_back(registry, arg);
+        }
+
+        return state_->create({vargs.begin(), vargs.end()});
+    }
+
+    template < detail::uvalue_element_kind T >
+    uresult constructor::try_create_variadic(std::span<T> args) const {
+        using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
+
+        if ( args.size() != get_arity() ) {
+            return META_HPP_PROFILE_RESULT(state_->profile, uerror(error_code::arity_mismatch));
+        }
+
+        type_registry& registry{type_registry::instance()};
+
+        detail::small_vector<uarg, META_HPP_VARIADIC_INLINE_ARITY> vargs{args.size()};
+
+        for ( T& arg : args ) {
+            vargs.emplace_back(registry, arg);
         }
-        return create_variadic(first, last);
+
+        return META_HPP_PROFILE_RESULT(state_->profile, state_->try_create({vargs.begin(), vargs.end()}));
     }
 
     template < typename Iter >
     uvalue constructor::create_variadic_at(void* mem, Iter first, Iter last) const {
         using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
 
         const std::size_t arity = get_arity();
         type_registry& registry{type_registry::instance()};
 
-        META_HPP_DETAIL_IGNORE_ALLOCA_WARNINGS_PUSH()
-
-        void* vargs_mem = META_HPP_ALLOCA(sizeof(uarg) * arity);
-        detail::inline_vector<uarg> vargs{static_cast<uarg*>(vargs_mem), arity};
-
-        META_HPP_DETAIL_IGNORE_ALLOCA_WARNINGS_POP()
+        detail::small_vector<uarg, META_HPP_VARIADIC_INLINE_ARITY> vargs{arity};
 
         for ( std::size_t i{}; first != last; ++i, ++first ) {
             if ( i >= arity ) {
@@ -315,10 +420,22 @@ namespace meta_hpp
 
     template < typename Iter >
     uresult constructor::try_create_variadic_at(void* mem, Iter first, Iter last) const {
-        if ( const uerror err = check_variadic_invocable_error(first, last) ) {
-            return err;
+        using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
+
+        const std::size_t arity = get_arity();
+        type_registry& registry{type_registry::instance()};
+
+        detail::small_vector<uarg, META_HPP_VARIADIC_INLINE_ARITY> vargs{arity};
+
+        for ( std::size_t i{}; first != last; ++i, ++first ) {
+            if ( i >= arity ) {
+                return META_HPP_PROFILE_RESULT(state_->profile, uerror(error_code::arity_mismatch));
+            }
+            vargs.emplace_back(registry, *first);
         }
-        return create_variadic_at(mem, first, last);
+
+        return META_HPP_PROFILE_RESULT(state_->profile, state_->try_create_at(mem, {vargs.begin(), vargs.end()}));
     }
 
     template < typename Iter >
@@ -333,12 +450,7 @@ namespace meta_hpp
         const std::size_t arity = get_arity();
         type_registry& registry{type_registry::instance()};
 
-        META_HPP_DETAIL_IGNORE_ALLOCA_WARNINGS_PUSH()
-
-        void* vargs_mem = META_HPP_ALLOCA(sizeof(uarg_base) * arity);
-        detail::inline_vector<uarg_base> vargs{static_cast<uarg_base*>(vargs_mem), arity};
-
-        META_HPP_DETAIL_IGNORE_ALLOCA_WARNINGS_POP()
+        detail::small_vector<uarg_base, META_HPP_VARIADIC_INLINE_ARITY> vargs{arity};
 
         for ( std::size_t i{}; first != last; ++i, ++first ) {
             if ( i >= arity ) {
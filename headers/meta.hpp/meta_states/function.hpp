@@ -11,15 +11,16 @@
 
 #include "../meta_detail/type_registry.hpp"
 #include "../meta_detail/value_utilities/uarg.hpp"
+#include "../meta_detail/value_utilities/usink.hpp"
+#include "../meta_plans/typed_function.hpp"
 #include "../meta_types/function_type.hpp"
 
 namespace meta_hpp::detail
 {
-    template < function_policy_family Policy, function_pointer_kind Function >
-    uvalue raw_function_invoke(type_registry& registry, Function function_ptr, std::span<const uarg> args) {
+    template < function_policy_family Policy, function_pointer_kind Function, typename Sink, typename... Args >
+    auto raw_function_call(const Sink& sink, Function function_ptr, Args&&... args) {
         using ft = function_traits<std::remove_pointer_t<Function>>;
         using return_type = typename ft::return_type;
-        using argument_types = typename ft::argument_types;
 
         constexpr bool as_copy                             //
             = std::is_constructible_v<uvalue, return_type> //
@@ -35,6 +36,27 @@ namespace meta_hpp::detail
 
         static_assert(as_copy || as_void || ref_as_ptr);
 
+        if constexpr ( std::is_void_v<return_type> ) {
+            function_ptr(META_HPP_FWD(args)...);
+            return sink();
+        } else if constexpr ( std::is_same_v<Policy, function_policy::discard_return_t> ) {
+            std::ignore = function_ptr(META_HPP_FWD(args)...);
+            return sink();
+        } else {
+            return_type&& result = function_ptr(META_HPP_FWD(args)...);
+            if constexpr ( ref_as_ptr ) {
+                return sink(std::addressof(result));
+            } else {
+                return sink(META_HPP_FWD(result));
+            }
+        }
+    }
+
+    template < function_policy_family Policy, function_pointer_kind Function, typename Sink = uvalue_usink >
+    auto raw_function_invoke(type_registry& registry, Function function_ptr, std::span<const uarg> args, const Sink& sink = {}) {
+        using ft = function_traits<std::remove_pointer_t<Function>>;
+        using argument_types = typename ft::argument_types;
+
         META_HPP_ASSERT(             //
             args.size() == ft::arity //
             && "an attempt to call a function with an incorrect arity"
@@ -45,21 +67,52 @@ namespace meta_hpp::detail
             && "an attempt to call a function with incorrect argument types"
         );
 
+        return unchecked_call_with_uargs<argument_types>(registry, args, [function_ptr, &sink](auto&&... all_args) {
+            return raw_function_call<Policy>(sink, function_ptr, META_HPP_FWD(all_args)...);
+        });
+    }
+
+    template < function_policy_family Policy, function_pointer_kind Function >
+    uresult raw_function_try_invoke(type_registry& registry, Function function_ptr, std::span<const uarg> args) {
+        using ft = function_traits<std::remove_pointer_t<Function>>;
+        using argument_types = typename ft::argument_types;
+
+        if ( args.size() != ft::arity ) {
+            return uerror{error_code::arity_mismatch};
+        }
+
+        if ( !can_cast_all_uargs<argument_types>(registry, args) ) {
+            return uerror{error_code::argument_type_mismatch};
+        }
+
         return unchecked_call_with_uargs<argument_types>(registry, args, [function_ptr](auto&&... all_args) {
-            if constexpr ( std::is_void_v<return_type> ) {
-                function_ptr(META_HPP_FWD(all_args)...);
-                return uvalue{};
-            }
+            return raw_function_call<Policy>(uvalue_usink{}, function_ptr, META_HPP_FWD(all_args)...);
+        });
+    }
 
-            if constexpr ( std::is_same_v<Policy, function_policy::discard_return_t> ) {
-                std::ignore = function_ptr(META_HPP_FWD(all_args)...);
-                return uvalue{};
-            }
+    template < function_policy_family Policy, function_pointer_kind Function >
+    void raw_function_invoke_at(type_registry& registry, Function function_ptr, const target_usink& sink, std::span<const uarg> args, bool planned) {
+        using ft = function_traits<std::remove_pointer_t<Function>>;
+        using return_type = typename ft::return_type;
+        using argument_types = typename ft::argument_types;
 
-            if constexpr ( !std::is_void_v<return_type> ) {
-                return_type&& result = function_ptr(META_HPP_FWD(all_args)...);
-                return ref_as_ptr ? uvalue{std::addressof(result)} : uvalue{META_HPP_FWD(result)};
-            }
+        constexpr bool as_copy                 //
+            = !std::is_void_v<return_type>     //
+           && std::is_same_v<Policy, function_policy::as_copy_t>;
+
+        META_HPP_ASSERT(                   //
+            (as_copy || !sink.is_memory()) //
+            && "an attempt to invoke a function into raw memory without a returned copy"
+        );
+
+        if ( !planned ) {
+            raw_function_invoke<Policy>(registry, function_ptr, args, sink);
+            return;
+        }
+
+        // planned arguments are checked once by their plan
+        unchecked_call_with_planned_uargs<argument_types>(args, [function_ptr, &sink](auto&&... all_args) {
+            raw_function_call<Policy>(sink, function_ptr, META_HPP_FWD(all_args)...);
         });
     }
 
@@ -89,6 +142,20 @@ namespace meta_hpp::detail
         };
     }
 
+    template < function_policy_family Policy, function_pointer_kind Function >
+    function_state::invoke_at_impl make_function_invoke_at(type_registry& registry, Function function_ptr) {
+        return [&registry, function_ptr](const target_usink& sink, std::span<const uarg> args, bool planned) { //
+            raw_function_invoke_at<Policy>(registry, function_ptr, sink, args, planned);
+        };
+    }
+
+    template < function_policy_family Policy, function_pointer_kind Function >
+    function_state::try_invoke_impl make_function_try_invoke(type_registry& registry, Function function_ptr) {
+        return [&registry, function_ptr](std::span<const uarg> args) { //
+            return raw_function_try_invoke<Policy>(registry, function_ptr, args);
+        };
+    }
+
     template < function_pointer_kind Function >
     function_state::invoke_error_impl make_function_invoke_error(type_registry& registry) {
         return [&registry](std::span<const uarg_base> args) { //
@@ -128,8 +195,11 @@ namespace meta_hpp::detail
         };
 
         state.invoke = make_function_invoke<Policy>(registry, function_ptr);
+        state.invoke_at = make_function_invoke_at<Policy>(registry, function_ptr);
+        state.try_invoke = make_function_try_invoke<Policy>(registry, function_ptr);
         state.invoke_error = make_function_invoke_error<Function>(registry);
         state.arguments = make_function_arguments<Function>();
+        state.pointer = uvalue{function_ptr};
 
         return std::make_shared<function_state>(std::move(state));
     }
@@ -174,18 +244,37 @@ namespace meta_hpp
     template < typename... Args >
     uvalue function::invoke(Args&&... args) const {
         using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
         type_registry& registry{type_registry::instance()};
         const std::array<uarg, sizeof...(Args)> vargs{uarg{registry, META_HPP_FWD(args)}...};
         return state_->invoke(vargs);
     }
 
+    template < typename... Args >
+    void function::invoke_into(uvalue& result, Args&&... args) const {
+        using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
+        type_registry& registry{type_registry::instance()};
+        const std::array<uarg, sizeof...(Args)> vargs{uarg{registry, META_HPP_FWD(args)}...};
+        state_->invoke_at(target_usink{result}, vargs, false);
+    }
+
+    template < typename... Args >
+    void function::invoke_into(void* mem, Args&&... args) const {
+        using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
+        type_registry& registry{type_registry::instance()};
+        const std::array<uarg, sizeof...(Args)> vargs{uarg{registry, META_HPP_FWD(args)}...};
+        state_->invoke_at(target_usink{mem}, vargs, false);
+    }
+
     template < typename... Args >
     uresult function::try_invoke(Args&&... args) const {
-        // doesn't actually move 'args', just checks conversion errors
-        if ( const uerror err = check_invocable_error(META_HPP_FWD(args)...) ) {
-            return err;
-        }
-        return invoke(META_HPP_FWD(args)...);
+        using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
+        type_registry& registry{type_registry::instance()};
+        const std::array<uarg, sizeof...(Args)> vargs{uarg{registry, META_HPP_FWD(args)}...};
+        return META_HPP_PROFILE_RESULT(state_->profile, state_->try_invoke(vargs));
     }
 
     template < typename... Args >
@@ -222,16 +311,12 @@ namespace meta_hpp
     template < typename Iter >
     uvalue function::invoke_variadic(Iter first, Iter last) const {
         using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
 
         const std::size_t arity = get_arity();
         type_registry& registry{type_registry::instance()};
 
-        META_HPP_DETAIL_IGNORE_ALLOCA_WARNINGS_PUSH()
-
-        void* vargs_mem = META_HPP_ALLOCA(sizeof(uarg) * arity);
-        detail::inline_vector<uarg> vargs{static_cast<uarg*>(vargs_mem), arity};
-
-        META_HPP_DETAIL_IGNORE_ALLOCA_WARNINGS_POP()
+        detail::small_vector<uarg, META_HPP_VARIADIC_INLINE_ARITY> vargs{arity};
 
         for ( std::size_t i{}; first != last; ++i, ++first ) {
             if ( i >= arity ) {
@@ -245,10 +330,62 @@ namespace meta_hpp
 
     template < typename Iter >
     uresult function::try_invoke_variadic(Iter first, Iter last) const {
-        if ( const uerror err = check_variadic_invocable_error(first, last) ) {
-            return err;
+        using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
+
+        const std::size_t arity = get_arity();
+        type_registry& registry{type_registry::instance()};
+
+        detail::small_vector<uarg, META_HPP_VARIADIC_INLINE_ARITY> vargs{arity};
+
+        for ( std::size_t i{}; first != last; ++i, ++first ) {
+            if ( i >= arity ) {
+                return META_HPP_PROFILE_RESULT(state_->profile, uerror(error_code::arity_mismatch));
+            }
+            vargs.emplace_back(registry, *first);
+        }
+
+        return META_HPP_PROFILE_RESULT(state_->profile, state_->try_invoke({vargs.begin(), vargs.end()}));
+    }
+
+    template < detail::uvalue_element_kind T >
+    uvalue function::invoke_variadic(std::span<T> args) const {
+        using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
+
+        if ( args.size() != get_arity() ) {
+            throw_exception(error_code::arity_mismatch);
+        }
+
+        type_registry& registry{type_registry::instance()};
+
+        detail::small_vector<uarg, META_HPP_VARIADIC_INLINE_ARITY> vargs{args.size()};
+
+        for ( T& arg : args ) {
+            vargs.emplace_back(registry, arg);
         }
-        return invoke_variadic(first, last);
+
+        return state_->invoke({vargs.begin(), vargs.end()});
+    }
+
+    template < detail::uvalue_element_kind T >
+    uresult function::try_invoke_variadic(std::span<T> args) const {
+        using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
+
+        if ( args.size() != get_arity() ) {
+            return META_HPP_PROFILE_RESULT(state_->profile, uerror(error_code::arity_mismatch));
+        }
+
+        type_registry& registry{type_registry::instance()};
+
+        detail::small_vector<uarg, META_HPP_VARIADIC_INLINE_ARITY> vargs{args.size()};
+
+        for ( T& arg : args ) {
+            vargs.emplace_back(registry, arg);
+        }
+
+        return META_HPP_PROFILE_RESULT(state_->profile, state_->try_invoke({vargs.begin(), vargs.end()}));
     }
 
     template < typename Iter >
@@ -263,12 +400,7 @@ namespace meta_hpp
         const std::size_t arity = get_arity();
         type_registry& registry{type_registry::instance()};
 
-        META_HPP_DETAIL_IGNORE_ALLOCA_WARNINGS_PUSH()
-
-        void* vargs_mem = META_HPP_ALLOCA(sizeof(uarg_base) * arity);
-        detail::inline_vector<uarg_base> vargs{static_cast<uarg_base*>(vargs_mem), arity};
-
-        META_HPP_DETAIL_IGNORE_ALLOCA_WARNINGS_POP()
+        detail::small_vector<uarg_base, META_HPP_VARIADIC_INLINE_ARITY> vargs{arity};
 
         for ( std::size_t i{}; first != last; ++i, ++first ) {
             if ( i >= arity ) {
@@ -279,4 +411,14 @@ namespace meta_hpp
 
         return state_->invoke_error({vargs.begin(), vargs.end()});
     }
+
+    template < typename Signature >
+    typed_function<Signature> function::as_typed() const {
+        using namespace detail;
+        if ( !is_valid() ) {
+            return typed_function<Signature>{};
+        }
+        type_registry& registry{type_registry::instance()};
+        return make_typed_function(registry, *state_, type_list<Signature>{});
+    }
 }
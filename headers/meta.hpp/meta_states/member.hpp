@@ -12,14 +12,14 @@
 #include "../meta_detail/type_registry.hpp"
 #include "../meta_detail/value_utilities/uarg.hpp"
 #include "../meta_detail/value_utilities/uinst.hpp"
+#include "../meta_detail/value_utilities/usink.hpp"
 #include "../meta_types/member_type.hpp"
 
 namespace meta_hpp::detail
 {
-    template < member_policy_family Policy, member_pointer_kind Member >
-    uvalue raw_member_getter(type_registry& registry, Member member_ptr, const uinst& inst) {
+    template < member_policy_family Policy, member_pointer_kind Member, typename Sink, typename Instance >
+    auto raw_member_get(const Sink& sink, Member member_ptr, Instance&& instance) {
         using mt = member_traits<Member>;
-        using class_type = typename mt::class_type;
         using value_type = typename mt::value_type;
 
         constexpr bool as_copy                                  //
@@ -34,43 +34,66 @@ namespace meta_hpp::detail
 
         static_assert(as_copy || as_ptr || as_ref_wrap);
 
+        auto&& return_value = META_HPP_FWD(instance).*member_ptr;
+
+        if constexpr ( as_copy ) {
+            return sink(META_HPP_FWD(return_value));
+        } else if constexpr ( as_ptr ) {
+            return sink(std::addressof(return_value));
+        } else {
+            return sink(std::ref(return_value));
+        }
+    }
+
+    template < member_policy_family Policy, member_pointer_kind Member >
+    uvalue raw_member_getter(type_registry& registry, Member member_ptr, const uinst& inst) {
+        using mt = member_traits<Member>;
+        using class_type = typename mt::class_type;
+
         if ( inst.is_inst_const() ) {
             META_HPP_ASSERT(                                 //
                 inst.can_cast_to<const class_type>(registry) //
                 && "an attempt to get a member with an incorrect instance type"
             );
 
-            auto&& return_value = inst.cast<const class_type>(registry).*member_ptr;
-
-            if constexpr ( as_copy ) {
-                return uvalue{META_HPP_FWD(return_value)};
-            }
-
-            if constexpr ( as_ptr ) {
-                return uvalue{std::addressof(return_value)};
-            }
-
-            if constexpr ( as_ref_wrap ) {
-                return uvalue{std::ref(return_value)};
-            }
+            return raw_member_get<Policy>(uvalue_usink{}, member_ptr, inst.cast<const class_type>(registry));
         } else {
             META_HPP_ASSERT(                           //
                 inst.can_cast_to<class_type>(registry) //
                 && "an attempt to get a member with an incorrect instance type"
             );
 
-            auto&& return_value = inst.cast<class_type>(registry).*member_ptr;
+            return raw_member_get<Policy>(uvalue_usink{}, member_ptr, inst.cast<class_type>(registry));
+        }
+    }
 
-            if constexpr ( as_copy ) {
-                return uvalue{META_HPP_FWD(return_value)};
-            }
+    template < member_policy_family Policy, member_pointer_kind Member >
+    void raw_member_getter_at(type_registry& registry, Member member_ptr, const target_usink& sink, const uinst& inst, bool planned) {
+        using mt = member_traits<Member>;
+        using class_type = typename mt::class_type;
 
-            if constexpr ( as_ptr ) {
-                return uvalue{std::addressof(return_value)};
+        // planned instances are checked once by their plan
+        if ( inst.is_inst_const() ) {
+            if ( planned ) {
+                raw_member_get<Policy>(sink, member_ptr, inst.planned_cast<const class_type>());
+            } else {
+                META_HPP_ASSERT(                                 //
+                    inst.can_cast_to<const class_type>(registry) //
+                    && "an attempt to get a member with an incorrect instance type"
+                );
+
+                raw_member_get<Policy>(sink, member_ptr, inst.cast<const class_type>(registry));
             }
-
-            if constexpr ( as_ref_wrap ) {
-                return uvalue{std::ref(return_value)};
+        } else {
+            if ( planned ) {
+                raw_member_get<Policy>(sink, member_ptr, inst.planned_cast<class_type>());
+            } else {
+                META_HPP_ASSERT(                           //
+                    inst.can_cast_to<class_type>(registry) //
+                    && "an attempt to get a member with an incorrect instance type"
+                );
+
+                raw_member_get<Policy>(sink, member_ptr, inst.cast<class_type>(registry));
             }
         }
     }
@@ -157,6 +180,112 @@ namespace meta_hpp::detail
     }
 }
 
+namespace meta_hpp::detail
+{
+    template < member_pointer_kind Member >
+    std::ptrdiff_t get_member_offset(Member member_ptr) noexcept {
+        using mt = member_traits<Member>;
+        using class_type = typename mt::class_type;
+
+        // applying a member pointer doesn't read the object, it only adjusts the pointer,
+        // so the offset is found from an aligned address without an object behind it
+        constexpr std::uintptr_t class_address{alignof(class_type)};
+
+        // NOLINTNEXTLINE(*-reinterpret-cast, *-no-int-to-ptr, *-int-to-ptr)
+        const class_type* class_ptr = reinterpret_cast<const class_type*>(class_address);
+
+        // NOLINTNEXTLINE(*-reinterpret-cast)
+        return static_cast<std::ptrdiff_t>(reinterpret_cast<std::uintptr_t>(std::addressof(class_ptr->*member_ptr)) - class_address);
+    }
+
+    [[nodiscard]] inline void* get_member_raw_address(const member_state& state, void* ptr, const class_type& from) {
+        void* owner_ptr = pointer_upcast(ptr, from, state.index.get_type().get_owner_type());
+
+        if ( owner_ptr == nullptr ) {
+            return nullptr;
+        }
+
+        return state.has_offset //
+                 ? static_cast<std::byte*>(owner_ptr) + state.offset
+                 : state.address(owner_ptr);
+    }
+
+    template < typename Instance >
+    [[nodiscard]] auto* get_raw_instance_ptr(Instance& instance) noexcept {
+        if constexpr ( std::is_pointer_v<std::remove_cv_t<Instance>> ) {
+            return instance;
+        } else {
+            return std::addressof(instance);
+        }
+    }
+
+    template < bool Writable, typename Instance >
+    void* get_member_raw_address(type_registry& registry, const member_state& state, Instance& instance, error_code& error) {
+        auto* instance_ptr = get_raw_instance_ptr(instance);
+
+        using cv_class_type = std::remove_pointer_t<decltype(instance_ptr)>;
+        using class_type = std::remove_cv_t<cv_class_type>;
+
+        static_assert(                                          //
+            class_kind<class_type> && !uvalue_family<class_type> //
+            && "raw member access requires a typed class instance or a pointer to it"
+        );
+
+        if ( !state.address ) {
+            error = error_code::bad_uvalue_operation;
+            return nullptr;
+        }
+
+        if constexpr ( Writable ) {
+            if ( std::is_const_v<cv_class_type> || state.index.get_type().get_flags().has(member_flags::is_readonly) ) {
+                error = error_code::bad_const_access;
+                return nullptr;
+            }
+        }
+
+        // NOLINTNEXTLINE(*-const-cast)
+        void* field_ptr = get_member_raw_address(state, const_cast<class_type*>(instance_ptr), registry.resolve_by_type<class_type>());
+        error = field_ptr != nullptr ? error_code::no_error : error_code::bad_instance_cast;
+        return field_ptr;
+    }
+}
+
+namespace meta_hpp::detail
+{
+    template < member_policy_family Policy, member_pointer_kind Member >
+    uresult raw_member_try_getter(type_registry& registry, Member member_ptr, const uinst& inst) {
+        using mt = member_traits<Member>;
+        using class_type = typename mt::class_type;
+
+        if ( const uerror err = raw_member_getter_error<Member>(registry, inst) ) {
+            return err;
+        }
+
+        if ( inst.is_inst_const() ) {
+            return raw_member_get<Policy>(uvalue_usink{}, member_ptr, inst.cast<const class_type>(registry));
+        } else {
+            return raw_member_get<Policy>(uvalue_usink{}, member_ptr, inst.cast<class_type>(registry));
+        }
+    }
+
+    template < member_pointer_kind Member >
+    uerror raw_member_try_setter(type_registry& registry, Member member_ptr, const uinst& inst, const uarg& arg) {
+        using mt = member_traits<Member>;
+        using class_type = typename mt::class_type;
+        using value_type = typename mt::value_type;
+
+        if ( const uerror err = raw_member_setter_error<Member>(registry, inst, arg) ) {
+            return err;
+        }
+
+        if constexpr ( !mt::is_readonly ) {
+            inst.cast<class_type>(registry).*member_ptr = arg.cast<value_type>(registry);
+        }
+
+        return uerror{error_code::no_error};
+    }
+}
+
 namespace meta_hpp::detail
 {
     template < member_policy_family Policy, member_pointer_kind Member >
@@ -173,6 +302,20 @@ namespace meta_hpp::detail
         };
     }
 
+    template < member_policy_family Policy, member_pointer_kind Member >
+    member_state::try_getter_impl make_member_try_getter(type_registry& registry, Member member_ptr) {
+        return [&registry, member_ptr](const uinst& inst) { //
+            return raw_member_try_getter<Policy>(registry, member_ptr, inst);
+        };
+    }
+
+    template < member_policy_family Policy, member_pointer_kind Member >
+    member_state::getter_at_impl make_member_getter_at(type_registry& registry, Member member_ptr) {
+        return [&registry, member_ptr](const target_usink& sink, const uinst& inst, bool planned) { //
+            raw_member_getter_at<Policy>(registry, member_ptr, sink, inst, planned);
+        };
+    }
+
     template < member_pointer_kind Member >
     member_state::setter_impl make_member_setter(type_registry& registry, Member member_ptr) {
         return [&registry, member_ptr](const uinst& inst, const uarg& arg) { //
@@ -180,12 +323,40 @@ namespace meta_hpp::detail
         };
     }
 
+    template < member_pointer_kind Member >
+    member_state::try_setter_impl make_member_try_setter(type_registry& registry, Member member_ptr) {
+        return [&registry, member_ptr](const uinst& inst, const uarg& arg) { //
+            return raw_member_try_setter(registry, member_ptr, inst, arg);
+        };
+    }
+
     template < member_pointer_kind Member >
     member_state::setter_error_impl make_member_setter_error(type_registry& registry) {
         return [&registry](const uinst_base& inst, const uarg_base& arg) { //
             return raw_member_setter_error<Member>(registry, inst, arg);
         };
     }
+
+    template < member_pointer_kind Member >
+    member_state::address_impl make_member_address(Member member_ptr) {
+        using mt = member_traits<Member>;
+        using class_type = typename mt::class_type;
+
+        return [member_ptr](void* ptr) -> void* { //
+            // NOLINTNEXTLINE(*-const-cast)
+            return const_cast<void*>(static_cast<const void*>(std::addressof(static_cast<class_type*>(ptr)->*member_ptr)));
+        };
+    }
+
+    template < member_pointer_kind Member >
+    member_state::raw_copy_impl make_member_raw_copy() {
+        using mt = member_traits<Member>;
+        using value_type = typename mt::value_type;
+
+        return [](void* dst, const void* src) { //
+            *static_cast<value_type*>(dst) = *static_cast<const value_type*>(src);
+        };
+    }
 }
 
 namespace meta_hpp::detail
@@ -205,9 +376,32 @@ namespace meta_hpp::detail
 
         state.getter = make_member_getter<Policy>(registry, member_ptr);
         state.setter = make_member_setter(registry, member_ptr);
+        state.try_getter = make_member_try_getter<Policy>(registry, member_ptr);
+        state.try_setter = make_member_try_setter(registry, member_ptr);
+        state.getter_at = make_member_getter_at<Policy>(registry, member_ptr);
         state.getter_error = make_member_getter_error<Member>(registry);
         state.setter_error = make_member_setter_error<Member>(registry);
 
+        using mt = member_traits<Member>;
+        using class_type = typename mt::class_type;
+        using value_type = typename mt::value_type;
+
+        // volatile members are never accessed raw
+        if constexpr ( !mt::is_volatile ) {
+            state.address = make_member_address(member_ptr);
+            state.value_size = sizeof(value_type);
+            state.is_trivially_copyable = std::is_trivially_copyable_v<value_type>;
+
+            if constexpr ( std::is_standard_layout_v<class_type> ) {
+                state.offset = get_member_offset(member_ptr);
+                state.has_offset = true;
+            }
+
+            if constexpr ( std::is_copy_assignable_v<value_type> ) {
+                state.raw_copy = make_member_raw_copy<Member>();
+            }
+        }
+
         return std::make_shared<member_state>(std::move(state));
     }
 
@@ -233,6 +427,7 @@ namespace meta_hpp
     template < typename Instance >
     uvalue member::get(Instance&& instance) const {
         using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->getter_profile);
         type_registry& registry{type_registry::instance()};
         const uinst vinst{registry, META_HPP_FWD(instance)};
         return state_->getter(vinst);
@@ -240,11 +435,11 @@ namespace meta_hpp
 
     template < typename Instance >
     uresult member::try_get(Instance&& instance) const {
-        // doesn't actually move an 'instance', just checks conversion errors
-        if ( const uerror err = check_gettable_error(META_HPP_FWD(instance)) ) {
-            return err;
-        }
-        return get(META_HPP_FWD(instance));
+        using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->getter_profile);
+        type_registry& registry{type_registry::instance()};
+        const uinst vinst{registry, META_HPP_FWD(instance)};
+        return META_HPP_PROFILE_RESULT(state_->getter_profile, state_->try_getter(vinst));
     }
 
     template < typename Instance >
@@ -252,9 +447,113 @@ namespace meta_hpp
         return get(META_HPP_FWD(instance));
     }
 
+    template < typename Instance >
+    uerror member::get_batch(std::span<Instance> instances, std::span<uvalue> results) const {
+        using namespace detail;
+        type_registry& registry{type_registry::instance()};
+
+        META_HPP_ASSERT(                       //
+            results.size() == instances.size() //
+            && "an attempt to get a member with an incorrect number of results"
+        );
+
+        // all instances of the span have the same static type,
+        // so the instance is checked only once
+        if ( const uerror err = check_gettable_error<Instance&>() ) {
+            return err;
+        }
+
+        const uinst_plan plan{registry, type_list<Instance&>{}, get_type().get_owner_type()};
+        const uinst_batch insts{plan, instances};
+
+        for ( std::size_t i{}; i < insts.size(); ++i ) {
+            state_->getter_at(target_usink{results[i]}, insts[i], true);
+        }
+
+        return uerror{error_code::no_error};
+    }
+
+    inline bool member::has_offset() const noexcept {
+        return state_->has_offset;
+    }
+
+    inline std::ptrdiff_t member::get_offset() const noexcept {
+        return state_->offset;
+    }
+
+    template < typename T, typename Instance >
+    T& member::get_ref(Instance&& instance) const {
+        using namespace detail;
+        type_registry& registry{type_registry::instance()};
+
+        error_code error{};
+        void* field_ptr = get_member_raw_address<!std::is_const_v<T>>(registry, *state_, instance, error);
+
+        if ( field_ptr == nullptr ) {
+            throw_exception(error);
+        }
+
+        if ( registry.resolve_by_type<std::remove_cv_t<T>>() != get_type().get_value_type() ) {
+            throw_exception(error_code::bad_cast);
+        }
+
+        return *static_cast<T*>(field_ptr);
+    }
+
+    template < typename Instance >
+    uerror member::read_raw(Instance&& instance, void* out) const {
+        using namespace detail;
+        type_registry& registry{type_registry::instance()};
+
+        error_code error{};
+        const void* field_ptr = get_member_raw_address<false>(registry, *state_, instance, error);
+
+        if ( field_ptr == nullptr ) {
+            return uerror{error};
+        }
+
+        if ( state_->is_trivially_copyable ) {
+            std::memcpy(out, field_ptr, state_->value_size);
+            return uerror{error_code::no_error};
+        }
+
+        if ( !state_->raw_copy ) {
+            return uerror{error_code::bad_uvalue_operation};
+        }
+
+        state_->raw_copy(out, field_ptr);
+        return uerror{error_code::no_error};
+    }
+
+    template < typename Instance >
+    uerror member::write_raw(Instance&& instance, const void* in) const {
+        using namespace detail;
+        type_registry& registry{type_registry::instance()};
+
+        error_code error{};
+        void* field_ptr = get_member_raw_address<true>(registry, *state_, instance, error);
+
+        if ( field_ptr == nullptr ) {
+            return uerror{error};
+        }
+
+        if ( state_->is_trivially_copyable ) {
+            std::memcpy(field_ptr, in, state_->value_size);
+            return uerror{error_code::no_error};
+        }
+
+        if ( !state_->raw_copy ) {
+            return uerror{error_code::bad_uvalue_operation};
+        }
+
+        state_->raw_copy(field_ptr, in);
+        return uerror{error_code::no_error};
+    }
+
     template < typename Instance, typename Value >
     void member::set(Instance&& instance, Value&& value) const {
         using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->setter_profile);
         type_registry& registry{type_registry::instance()};
         const uinst vinst{registry, META_HPP_FWD(instance)};
         const uarg vvalue{registry, META_HPP_FWD(value)};
@@ -263,12 +562,12 @@ namespace meta_hpp
 
     template < typename Instance, typename Value >
     uresult member::try_set(Instance&& instance, Value&& value) const {
-        // doesn't actually move an 'instance' and a 'value', just checks conversion errors
-        if ( const uerror err = check_settable_error(META_HPP_FWD(instance), META_HPP_FWD(value)) ) {
-            return err;
-        }
-        set(META_HPP_FWD(instance), META_HPP_FWD(value));
-        return uerror{error_code::no_error};
+        using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->setter_profile);
+        type_registry& registry{type_registry::instance()};
+        const uinst vinst{registry, META_HPP_FWD(instance)};
+        const uarg vvalue{registry, META_HPP_FWD(value)};
+        return META_HPP_PROFILE_RESULT(state_->setter_profile, state_->try_setter(vinst, vvalue));
     }
 
     template < typename Instance, typename Value >
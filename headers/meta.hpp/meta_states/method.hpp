@@ -12,16 +12,16 @@
 #include "../meta_detail/type_registry.hpp"
 #include "../meta_detail/value_utilities/uarg.hpp"
 #include "../meta_detail/value_utilities/uinst.hpp"
+#include "../meta_detail/value_utilities/usink.hpp"
+#include "../meta_plans/typed_method.hpp"
 #include "../meta_types/method_type.hpp"
 
 namespace meta_hpp::detail
 {
-    template < method_policy_family Policy, method_pointer_kind Method >
-    uvalue raw_method_invoke(type_registry& registry, Method method_ptr, const uinst& inst, std::span<const uarg> args) {
+    template < method_policy_family Policy, method_pointer_kind Method, typename Sink, typename Instance, typename... Args >
+    auto raw_method_call(const Sink& sink, Method method_ptr, Instance&& instance, Args&&... args) {
         using mt = method_traits<Method>;
         using return_type = typename mt::return_type;
-        using qualified_type = typename mt::qualified_type;
-        using argument_types = typename mt::argument_types;
 
         constexpr bool as_copy                             //
             = std::is_constructible_v<uvalue, return_type> //
@@ -37,6 +37,34 @@ namespace meta_hpp::detail
 
         static_assert(as_copy || as_void || ref_as_ptr);
 
+        if constexpr ( std::is_void_v<return_type> ) {
+            (META_HPP_FWD(instance).*method_ptr)(META_HPP_FWD(args)...);
+            return sink();
+        } else if constexpr ( std::is_same_v<Policy, method_policy::discard_return_t> ) {
+            std::ignore = (META_HPP_FWD(instance).*method_ptr)(META_HPP_FWD(args)...);
+            return sink();
+        } else {
+            return_type&& result = (META_HPP_FWD(instance).*method_ptr)(META_HPP_FWD(args)...);
+            if constexpr ( ref_as_ptr ) {
+                return sink(std::addressof(result));
+            } else {
+                return sink(META_HPP_FWD(result));
+            }
+        }
+    }
+
+    template < method_policy_family Policy, method_pointer_kind Method, typename Sink = uvalue_usink >
+    auto raw_method_invoke(
+        type_registry& registry,
+        Method method_ptr,
+        const uinst& inst,
+        std::span<const uarg> args,
+        const Sink& sink = {}
+    ) {
+        using mt = method_traits<Method>;
+        using qualified_type = typename mt::qualified_type;
+        using argument_types = typename mt::argument_types;
+
         META_HPP_ASSERT(             //
             args.size() == mt::arity //
             && "an attempt to call a method with an incorrect arity"
@@ -52,21 +80,65 @@ namespace meta_hpp::detail
             && "an attempt to call a method with incorrect argument types"
         );
 
+        return unchecked_call_with_uargs<argument_types>(registry, args, [method_ptr, &inst, &registry, &sink](auto&&... all_args) {
+            return raw_method_call<Policy>(sink, method_ptr, inst.cast<qualified_type>(registry), META_HPP_FWD(all_args)...);
+        });
+    }
+
+    template < method_policy_family Policy, method_pointer_kind Method >
+    uresult raw_method_try_invoke(type_registry& registry, Method method_ptr, const uinst& inst, std::span<const uarg> args) {
+        using mt = method_traits<Method>;
+        using qualified_type = typename mt::qualified_type;
+        using argument_types = typename mt::argument_types;
+
+        if ( args.size() != mt::arity ) {
+            return uerror{error_code::arity_mismatch};
+        }
+
+        if ( !inst.can_cast_to<qualified_type>(registry) ) {
+            return uerror{error_code::instance_type_mismatch};
+        }
+
+        if ( !can_cast_all_uargs<argument_types>(registry, args) ) {
+            return uerror{error_code::argument_type_mismatch};
+        }
+
         return unchecked_call_with_uargs<argument_types>(registry, args, [method_ptr, &inst, &registry](auto&&... all_args) {
-            if constexpr ( std::is_void_v<return_type> ) {
-                (inst.cast<qualified_type>(registry).*method_ptr)(META_HPP_FWD(all_args)...);
-                return uvalue{};
-            }
+            return raw_method_call<Policy>(uvalue_usink{}, method_ptr, inst.cast<qualified_type>(registry), META_HPP_FWD(all_args)...);
+        });
+    }
 
-            if constexpr ( std::is_same_v<Policy, method_policy::discard_return_t> ) {
-                std::ignore = (inst.cast<qualified_type>().*method_ptr)(META_HPP_FWD(all_args)...);
-                return uvalue{};
-            }
+    template < method_policy_family Policy, method_pointer_kind Method >
+    void raw_method_invoke_at(
+        type_registry& registry,
+        Method method_ptr,
+        const target_usink& sink,
+        const uinst& inst,
+        std::span<const uarg> args,
+        bool planned
+    ) {
+        using mt = method_traits<Method>;
+        using return_type = typename mt::return_type;
+        using qualified_type = typename mt::qualified_type;
+        using argument_types = typename mt::argument_types;
 
-            if constexpr ( !std::is_void_v<return_type> ) {
-                return_type&& result = (inst.cast<qualified_type>(registry).*method_ptr)(META_HPP_FWD(all_args)...);
-                return ref_as_ptr ? uvalue{std::addressof(result)} : uvalue{META_HPP_FWD(result)};
-            }
+        constexpr bool as_copy                 //
+            = !std::is_void_v<return_type>     //
+           && std::is_same_v<Policy, method_policy::as_copy_t>;
+
+        META_HPP_ASSERT(                   //
+            (as_copy || !sink.is_memory()) //
+            && "an attempt to invoke a method into raw memory without a returned copy"
+        );
+
+        if ( !planned ) {
+            raw_method_invoke<Policy>(registry, method_ptr, inst, args, sink);
+            return;
+        }
+
+        // planned instances and arguments are checked once by their plan
+        unchecked_call_with_planned_uargs<argument_types>(args, [method_ptr, &inst, &sink](auto&&... all_args) {
+            raw_method_call<Policy>(sink, method_ptr, inst.planned_cast<qualified_type>(), META_HPP_FWD(all_args)...);
         });
     }
 
@@ -101,6 +173,20 @@ namespace meta_hpp::detail
         };
     }
 
+    template < method_policy_family Policy, method_pointer_kind Method >
+    method_state::invoke_at_impl make_method_invoke_at(type_registry& registry, Method method_ptr) {
+        return [&registry, method_ptr](const target_usink& sink, const uinst& inst, std::span<const uarg> args, bool planned) {
+            raw_method_invoke_at<Policy>(registry, method_ptr, sink, inst, args, planned);
+        };
+    }
+
+    template < method_policy_family Policy, method_pointer_kind Method >
+    method_state::try_invoke_impl make_method_try_invoke(type_registry& registry, Method method_ptr) {
+        return [&registry, method_ptr](const uinst& inst, std::span<const uarg> args) {
+            return raw_method_try_invoke<Policy>(registry, method_ptr, inst, args);
+        };
+    }
+
     template < method_pointer_kind Method >
     method_state::invoke_error_impl make_method_invoke_error(type_registry& registry) {
         return [&registry](const uinst_base& inst, std::span<const uarg_base> args) {
@@ -140,8 +226,11 @@ namespace meta_hpp::detail
         };
 
         state.invoke = make_method_invoke<Policy>(registry, method_ptr);
+        state.invoke_at = make_method_invoke_at<Policy>(registry, method_ptr);
+        state.try_invoke = make_method_try_invoke<Policy>(registry, method_ptr);
         state.invoke_error = make_method_invoke_error<Method>(registry);
         state.arguments = make_method_arguments<Method>();
+        state.pointer = uvalue{method_ptr};
 
         return std::make_shared<method_state>(std::move(state));
     }
@@ -186,19 +275,94 @@ namespace meta_hpp
     template < typename Instance, typename... Args >
     uvalue method::invoke(Instance&& instance, Args&&... args) const {
         using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
         type_registry& registry{type_registry::instance()};
         const uinst vinst{registry, META_HPP_FWD(instance)};
         const std::array<uarg, sizeof...(Args)> vargs{uarg{registry, META_HPP_FWD(args)}...};
         return state_->invoke(vinst, vargs);
     }
 
+    template < typename Instance, typename... Args >
+    void method::invoke_into(uvalue& result, Instance&& instance, Args&&... args) const {
+        using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
+        type_registry& registry{type_registry::instance()};
+        const uinst vinst{registry, META_HPP_FWD(instance)};
+        const std::array<uarg, sizeof...(Args)> vargs{uarg{registry, META_HPP_FWD(args)}...};
+        state_->invoke_at(target_usink{result}, vinst, vargs, false);
+    }
+
+    template < typename Instance, typename... Args >
+    void method::invoke_into(void* mem, Instance&& instance, Args&&... args) const {
+        using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
+        type_registry& registry{type_registry::instance()};
+        const uinst vinst{registry, META_HPP_FWD(instance)};
+        const std::array<uarg, sizeof...(Args)> vargs{uarg{registry, META_HPP_FWD(args)}...};
+        state_->invoke_at(target_usink{mem}, vinst, vargs, false);
+    }
+
     template < typename Instance, typename... Args >
     uresult method::try_invoke(Instance&& instance, Args&&... args) const {
-        // doesn't actually move an 'instance' and 'args', just checks conversion errors
-        if ( const uerror err = check_invocable_error(META_HPP_FWD(instance), META_HPP_FWD(args)...) ) {
-            return err;
+        using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
+        type_registry& registry{type_registry::instance()};
+        const uinst vinst{registry, META_HPP_FWD(instance)};
+        const std::array<uarg, sizeof...(Args)> vargs{uarg{registry, META_HPP_FWD(args)}...};
+        return META_HPP_PROFILE_RESULT(state_->profile, state_->try_invoke(vinst, vargs));
+    }
+
+    template < typename Instance, typename... Args >
+    uerror method::invoke_batch(std::span<Instance> instances, Args&&... args) const {
+        return invoke_batch(instances, std::span<uvalue>{}, META_HPP_FWD(args)...);
+    }
+
+    template < typename Instance, typename... Args >
+    uerror method::invoke_batch(std::span<Instance> instances, std::span<uvalue> results, Args&&... args) const {
+        using namespace detail;
+        type_registry& registry{type_registry::instance()};
+
+        META_HPP_ASSERT(                                            //
+            (results.empty() || results.size() == instances.size()) //
+            && "an attempt to call a method with an incorrect number of results"
+        );
+
+        {
+            // all instances of the span have the same static type, so the instance
+            // and the arguments are checked only once. arguments are passed to every
+            // call as lvalues, so value parameters get copies of them
+            const uinst_base vinst{registry, type_list<Instance&>{}};
+            const std::array<uarg_base, sizeof...(Args)> vargs{uarg_base{registry, args}...};
+            if ( const uerror err = state_->invoke_error(vinst, vargs) ) {
+                return err;
+            }
         }
-        return invoke(META_HPP_FWD(instance), META_HPP_FWD(args)...);
+
+        const method_type& type = get_type();
+        const uinst_plan plan{registry, type_list<Instance&>{}, type.get_owner_type()};
+        const uinst_batch insts{plan, instances};
+
+        // arguments of static types are planned once for the whole batch,
+        // dynamic 'uvalue' arguments are cast for every call
+        constexpr bool planned{(... && plan_arg_kind<Args>)};
+
+        [[maybe_unused]] std::array<void*, sizeof...(Args)> pointer_slots{};
+        const std::array<uarg, sizeof...(Args)> vargs = [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            if constexpr ( planned ) {
+                return std::array<uarg, sizeof...(Args)>{
+                    uarg_plan{registry, type_list<std::remove_reference_t<Args>&>{}, type.get_argument_type(Is)} //
+                        .make_uarg(args, pointer_slots[Is])...,
+                };
+            } else {
+                return std::array<uarg, sizeof...(Args)>{uarg{registry, args}...};
+            }
+        }(std::make_index_sequence<sizeof...(Args)>());
+
+        for ( std::size_t i{}; i < insts.size(); ++i ) {
+            state_->invoke_at(results.empty() ? target_usink{} : target_usink{results[i]}, insts[i], vargs, planned);
+        }
+
+        return uerror{error_code::no_error};
     }
 
     template < typename Instance, typename... Args >
@@ -237,16 +401,12 @@ namespace meta_hpp
     template < typename Instance, typename Iter >
     uvalue method::invoke_variadic(Instance&& instance, Iter first, Iter last) const {
         using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
 
         const std::size_t arity = get_arity();
         type_registry& registry{type_registry::instance()};
 
-        META_HPP_DETAIL_IGNORE_ALLOCA_WARNINGS_PUSH()
-
-        void* vargs_mem = META_HPP_ALLOCA(sizeof(uarg) * arity);
-        detail::inline_vector<uarg> vargs{static_cast<uarg*>(vargs_mem), arity};
-
-        META_HPP_DETAIL_IGNORE_ALLOCA_WARNINGS_POP()
+        detail::small_vector<uarg, META_HPP_VARIADIC_INLINE_ARITY> vargs{arity};
 
         for ( std::size_t i{}; first != last; ++i, ++first ) {
             if ( i >= arity ) {
@@ -261,11 +421,65 @@ namespace meta_hpp
 
     template < typename Instance, typename Iter >
     uresult method::try_invoke_variadic(Instance&& instance, Iter first, Iter last) const {
-        // doesn't actually move an 'instance', just checks conversion errors
-        if ( const uerror err = check_variadic_invocable_error(META_HPP_FWD(instance), first, last) ) {
-            return err;
+        using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
+
+        const std::size_t arity = get_arity();
+        type_registry& registry{type_registry::instance()};
+
+        detail::small_vector<uarg, META_HPP_VARIADIC_INLINE_ARITY> vargs{arity};
+
+        for ( std::size_t i{}; first != last; ++i, ++first ) {
+            if ( i >= arity ) {
+                return META_HPP_PROFILE_RESULT(state_->profile, uerror(error_code::arity_mismatch));
+            }
+            vargs.emplace_back(registry, *first);
         }
-        return invoke_variadic(META_HPP_FWD(instance), first, last);
+
+        const uinst vinst{registry, META_HPP_FWD(instance)};
+        return META_HPP_PROFILE_RESULT(state_->profile, state_->try_invoke(vinst, {vargs.begin(), vargs.end()}));
+    }
+
+    template < typename Instance, detail::uvalue_element_kind T >
+    uvalue method::invoke_variadic(Instance&& instance, std::span<T> args) const {
+        using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
+
+        if ( args.size() != get_arity() ) {
+            throw_exception(error_code::arity_mismatch);
+        }
+
+        type_registry& registry{type_registry::instance()};
+
+        detail::small_vector<uarg, META_HPP_VARIADIC_INLINE_ARITY> vargs{args.size()};
+
+        for ( T& arg : args ) {
+            vargs.emplace_back(registry, arg);
+        }
+
+        const uinst vinst{registry, META_HPP_FWD(instance)};
+        return state_->invoke(vinst, {vargs.begin(), vargs.end()});
+    }
+
+    template < typename Instance, detail::uvalue_element_kind T >
+    uresult method::try_invoke_variadic(Instance&& instance, std::span<T> args) const {
+        using namespace detail;
+        META_HPP_PROFILE_SCOPE(state_->profile);
+
+        if ( args.size() != get_arity() ) {
+            return META_HPP_PROFILE_RESULT(state_->profile, uerror(error_code::arity_mismatch));
+        }
+
+        type_registry& registry{type_registry::instance()};
+
+        detail::small_vector<uarg, META_HPP_VARIADIC_INLINE_ARITY> vargs{args.size()};
+
+        for ( T& arg : args ) {
+            vargs.emplace_back(registry, arg);
+        }
+
+        const uinst vinst{registry, META_HPP_FWD(instance)};
+        return META_HPP_PROFILE_RESULT(state_->profile, state_->try_invoke(vinst, {vargs.begin(), vargs.end()}));
     }
 
     template < typename Instance, typename Iter >
@@ -280,12 +494,7 @@ namespace meta_hpp
         const std::size_t arity = get_arity();
         type_registry& registry{type_registry::instance()};
 
-        META_HPP_DETAIL_IGNORE_ALLOCA_WARNINGS_PUSH()
-
-        void* vargs_mem = META_HPP_ALLOCA(sizeof(uarg_base) * arity);
-        detail::inline_vector<uarg_base> vargs{static_cast<uarg_base*>(vargs_mem), arity};
-
-        META_HPP_DETAIL_IGNORE_ALLOCA_WARNINGS_POP()
+        detail::small_vector<uarg_base, META_HPP_VARIADIC_INLINE_ARITY> vargs{arity};
 
         for ( std::size_t i{}; first != last; ++i, ++first ) {
             if ( i >= arity ) {
@@ -297,4 +506,14 @@ namespace meta_hpp
         const uinst_base vinst{registry, META_HPP_FWD(instance)};
         return state_->invoke_error(vinst, {vargs.begin(), vargs.end()});
     }
+
+    template < typename Signature >
+    typed_method<Signature> method::as_typed() const {
+        using namespace detail;
+        if ( !is_valid() ) {
+            return typed_method<Signature>{};
+        }
+        type_registry& registry{type_registry::instance()};
+        return make_typed_method(registry, *state_, type_list<Signature>{});
+    }
 }
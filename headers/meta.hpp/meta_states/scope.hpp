@@ -33,11 +33,14 @@ namespace meta_hpp::detail
     inline void scope_state::purge_binds() {
         functions.clear();
         functions.shrink_to_fit();
+        function_names.clear();
+        function_signatures.clear();
 
         typedefs.clear();
 
         variables.clear();
         variables.shrink_to_fit();
+        variable_names.clear();
     }
 
     inline void scope_state::purge_metadata() {
@@ -64,12 +67,7 @@ namespace meta_hpp
     }
 
     inline function scope::get_function(std::string_view name) const noexcept {
-        for ( const function& function : state_->functions ) {
-            if ( function.get_name() == name ) {
-                return function;
-            }
-        }
-        return function{};
+        return detail::find_by_name(state_->functions, state_->function_names, name);
     }
 
     inline any_type scope::get_typedef(std::string_view name) const noexcept {
@@ -80,12 +78,7 @@ namespace meta_hpp
     }
 
     inline variable scope::get_variable(std::string_view name) const noexcept {
-        for ( const variable& variable : state_->variables ) {
-            if ( variable.get_name() == name ) {
-                return variable;
-            }
-        }
-        return variable{};
+        return detail::find_by_name(state_->variables, state_->variable_names, name);
     }
 
     template < typename... Args >
@@ -102,19 +95,20 @@ namespace meta_hpp
         Iter first,
         Iter last
     ) const {
-        for ( const function& function : state_->functions ) {
+        const std::size_t signature{detail::signature_index::make_signature(name, first, last)};
+
+        const std::size_t position{state_->function_signatures.find_first(signature, [this, name, first, last](std::size_t index) {
+            const function& function = state_->functions[index];
             if ( function.get_name() != name ) {
-                continue;
+                return false;
             }
 
             const function_type& function_type = function.get_type();
             const any_type_list& function_args = function_type.get_argument_types();
+            return std::equal(first, last, function_args.begin(), function_args.end());
+        })};
 
-            if ( std::equal(first, last, function_args.begin(), function_args.end()) ) {
-                return function;
-            }
-        }
-        return function{};
+        return position < state_->functions.size() ? state_->functions[position] : function{};
     }
 
     inline function scope::get_function_with( //
@@ -30,6 +30,7 @@ namespace meta_hpp
 
         void swap(type_id& other) noexcept;
         [[nodiscard]] std::size_t get_hash() const noexcept;
+        [[nodiscard]] std::size_t get_index() const noexcept;
 
         [[nodiscard]] bool operator==(const type_id& other) const noexcept;
         [[nodiscard]] std::strong_ordering operator<=>(const type_id& other) const noexcept;
@@ -79,6 +80,7 @@ namespace meta_hpp
         [[nodiscard]] explicit operator bool() const noexcept;
 
         [[nodiscard]] std::size_t get_hash() const noexcept;
+        [[nodiscard]] std::size_t get_index() const noexcept;
 
         [[nodiscard]] id_type get_id() const noexcept;
         [[nodiscard]] type_kind get_kind() const noexcept;
@@ -295,6 +297,13 @@ namespace meta_hpp
         [[nodiscard]] evalue value_to_evalue(Enum value) const;
         [[nodiscard]] evalue value_to_evalue(const uvalue& value) const;
         [[nodiscard]] evalue name_to_evalue(std::string_view name) const noexcept;
+
+        template < enum_kind Enum >
+        [[nodiscard]] std::string_view value_to_name(Enum value) const;
+        [[nodiscard]] std::string_view value_to_name(const uvalue& value) const;
+
+        template < enum_kind Enum >
+        [[nodiscard]] std::optional<Enum> name_to_value(std::string_view name) const;
     };
 
     class function_type final : public type_base<function_type> {
@@ -412,6 +421,9 @@ namespace meta_hpp::detail
         const std::size_t shared;
         // NOLINTEND(*-avoid-const-or-ref-data-members)
 
+        // a dense index assigned by the type registry, starting from one
+        std::size_t index{};
+
         metadata_map metadata;
 
         type_data_base() = delete;
@@ -463,26 +475,82 @@ namespace meta_hpp::detail
         typedef_map typedefs;
         variable_list variables;
 
+        name_index function_names;
+        name_index member_names;
+        name_index method_names;
+        name_index variable_names;
+
+        signature_index constructor_signatures;
+        signature_index function_signatures;
+        signature_index method_signatures;
+
+        mutable overload_cache constructor_overloads;
+
         struct upcast_func_t final {
             using upcast_t = void* (*)(void*);
 
             type_id target{};
+
+            // non-virtual bases are reached by a constant pointer adjustment,
+            // virtual bases need a real cast through the 'upcast' function
             upcast_t upcast{};
+            std::ptrdiff_t offset{};
+            bool has_offset{};
+
+            [[nodiscard]] bool is_valid() const noexcept;
 
             [[nodiscard]] void* apply(void* ptr) const noexcept;
             [[nodiscard]] const void* apply(const void* ptr) const noexcept;
         };
 
+        // sorted by target, only the first found path to each base is kept
         using deep_upcasts_t = std::vector<upcast_func_t>;
 
         class_list base_classes;
         deep_upcasts_t deep_upcasts;
 
+        // sorted by target, every path to every base is kept (including
+        // ambiguous ones) to find bases by their subobjects in down-casts
+        deep_upcasts_t upcast_paths;
+
+        // an immutable snapshot of all names visible from the class, it's
+        // rebuilt at the end of a bind and published for lock-free readers
+        struct flat_lookup_t final {
+            template < typename Value >
+            using name_map_t = std::unordered_map<std::string_view, Value>;
+
+            name_map_t<function> functions;
+            name_map_t<member> members;
+            name_map_t<method> methods;
+            name_map_t<any_type> typedefs;
+            name_map_t<variable> variables;
+        };
+
+        // replaced tables are kept alive for readers that still use them, so
+        // every bind of the class or its bases retains one until 'purge_binds'
+        std::vector<std::unique_ptr<const flat_lookup_t>> flat_lookup_tables;
+        std::atomic<const flat_lookup_t*> flat_lookup{};
+        std::atomic<std::size_t> flat_lookup_version{};
+        bool flat_lookup_dirty{};
+
+        // classes that have this one as a direct base, guarded by the type registry lock
+        std::vector<class_type_data*> derived_classes;
+
         template < class_kind Class >
         explicit class_type_data(class_traits<Class>);
 
         void purge_binds() override;
         void purge_metadata() override;
+
+        [[nodiscard]] const upcast_func_t* find_upcast(const type_id& target) const noexcept;
+        [[nodiscard]] std::span<const upcast_func_t> find_upcast_paths(const type_id& target) const noexcept;
+
+        [[nodiscard]] const flat_lookup_t* get_flat_lookup() const noexcept;
+        [[nodiscard]] std::size_t get_flat_lookup_version() const noexcept;
+
+        void invalidate_flat_lookup() noexcept;
+        void update_flat_lookup();
+        void release_flat_lookups() noexcept;
     };
 
     struct constructor_type_data final : type_data_base {
@@ -520,11 +588,17 @@ namespace meta_hpp::detail
 
         evalue_list evalues;
 
+        name_index evalue_names;
+        integral_index evalue_values;
+
         template < enum_kind Enum >
         explicit enum_type_data(enum_traits<Enum>);
 
         void purge_binds() override;
         void purge_metadata() override;
+
+        void update_value_index();
+        [[nodiscard]] integral_index::key_type make_value_key(const void* value) const noexcept;
     };
 
     struct function_type_data final : type_data_base {
@@ -648,6 +722,10 @@ namespace meta_hpp
         return data_ != nullptr ? data_->shared : 0;
     }
 
+    inline std::size_t type_id::get_index() const noexcept {
+        return data_ != nullptr ? data_->index : 0;
+    }
+
     inline bool type_id::operator==(const type_id& other) const noexcept {
         if ( data_ == other.data_ ) {
             return true;
@@ -695,6 +773,11 @@ namespace meta_hpp
         return get_id().get_hash();
     }
 
+    template < type_family Type >
+    std::size_t type_base<Type>::get_index() const noexcept {
+        return get_id().get_index();
+    }
+
     template < type_family Type >
     typename type_base<Type>::id_type type_base<Type>::get_id() const noexcept {
         return id_type{data_};
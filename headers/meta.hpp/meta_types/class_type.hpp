@@ -18,6 +18,7 @@
 #include "../meta_states/variable.hpp"
 
 #include "../meta_detail/type_sharing.hpp"
+#include "../meta_detail/upcast_cache.hpp"
 #include "../meta_detail/type_traits/class_traits.hpp"
 
 namespace meta_hpp::detail::class_type_data_impl
@@ -25,24 +26,39 @@ namespace meta_hpp::detail::class_type_data_impl
     struct new_base_info_t final {
         class_list base_classes;
         class_type_data::deep_upcasts_t deep_upcasts;
+        class_type_data::deep_upcasts_t upcast_paths;
     };
 
     template < class_kind Class, class_kind Target >
-    void add_upcast_info(new_base_info_t& info) {
-        const class_type_data::upcast_func_t::upcast_t class_to_target = []() {
-            if constexpr ( requires { static_cast<Target*>(std::declval<Class*>()); } ) {
-                return +[](void* from) -> void* { //
-                    return static_cast<Target*>(static_cast<Class*>(from));
-                };
-            } else {
-                return nullptr;
-            }
-        }();
+    std::ptrdiff_t get_upcast_offset() noexcept {
+        // a non-virtual upcast doesn't read the object, it only adjusts the pointer,
+        // so the offset is found from an aligned address without an object behind it
+        constexpr std::uintptr_t class_address{alignof(Class)};
+
+        // NOLINTNEXTLINE(*-reinterpret-cast, *-no-int-to-ptr, *-int-to-ptr)
+        const Target* target_ptr = static_cast<const Target*>(reinterpret_cast<const Class*>(class_address));
 
-        info.deep_upcasts.push_back(class_type_data::upcast_func_t{
+        // NOLINTNEXTLINE(*-reinterpret-cast)
+        return static_cast<std::ptrdiff_t>(reinterpret_cast<std::uintptr_t>(target_ptr) - class_address);
+    }
+
+    template < class_kind Class, class_kind Target >
+    void add_upcast_info(new_base_info_t& info) {
+        class_type_data::upcast_func_t upcast_func{
             .target{resolve_type<Target>().get_id()},
-            .upcast{class_to_target},
-        });
+        };
+
+        if constexpr ( requires { static_cast<Class*>(std::declval<Target*>()); } ) {
+            // only unambiguous non-virtual bases can be casted back statically
+            upcast_func.offset = get_upcast_offset<Class, Target>();
+            upcast_func.has_offset = true;
+        } else if constexpr ( requires { static_cast<Target*>(std::declval<Class*>()); } ) {
+            upcast_func.upcast = +[](void* from) -> void* { //
+                return static_cast<Target*>(static_cast<Class*>(from));
+            };
+        }
+
+        info.deep_upcasts.push_back(upcast_func);
 
         if constexpr ( check_base_info_enabled<Target> ) {
             [&info]<typename... TargetBases>(type_list<TargetBases...>) {
@@ -51,16 +67,125 @@ namespace meta_hpp::detail::class_type_data_impl
         }
     }
 
+    template < class_kind From, class_kind Base, class_kind... Bases >
+    consteval bool is_upcast_path_valid() noexcept {
+        if constexpr ( !requires { static_cast<Base*>(std::declval<From*>()); } ) {
+            return false;
+        } else if constexpr ( sizeof...(Bases) == 0 ) {
+            return true;
+        } else {
+            return is_upcast_path_valid<Base, Bases...>();
+        }
+    }
+
+    template < class_kind From, class_kind Base, class_kind... Bases >
+    void* path_upcast(From* from) noexcept {
+        if constexpr ( sizeof...(Bases) == 0 ) {
+            return static_cast<Base*>(from);
+        } else {
+            return path_upcast<Base, Bases...>(static_cast<Base*>(from));
+        }
+    }
+
+    template < class_kind Class, class_kind... Path >
+    void add_upcast_path(new_base_info_t& info) {
+        using target_type = type_list_at_t<sizeof...(Path) - 1, type_list<Path...>>;
+
+        class_type_data::upcast_func_t upcast_func{
+            .target{resolve_type<target_type>().get_id()},
+        };
+
+        // every step of a path is a cast to a direct base, it's ill-formed
+        // only when the direct base is also an indirect one (an ambiguous path)
+        if constexpr ( is_upcast_path_valid<Class, Path...>() ) {
+            upcast_func.upcast = +[](void* from) -> void* { //
+                return path_upcast<Class, Path...>(static_cast<Class*>(from));
+            };
+        }
+
+        info.upcast_paths.push_back(upcast_func);
+
+        if constexpr ( check_base_info_enabled<target_type> ) {
+            [&info]<typename... TargetBases>(type_list<TargetBases...>) {
+                (add_upcast_path<Class, Path..., TargetBases>(info), ...);
+            }(get_meta_base_info<target_type>{});
+        }
+    }
+
     template < class_kind Class >
     void fill_upcast_info(new_base_info_t& info) {
         if constexpr ( check_base_info_enabled<Class> ) {
             [&info]<typename... ClassBases>(type_list<ClassBases...>) {
                 (info.base_classes.push_back(resolve_type<ClassBases>()), ...);
                 (add_upcast_info<Class, ClassBases>(info), ...);
+                (add_upcast_path<Class, ClassBases>(info), ...);
             }(get_meta_base_info<Class>{});
         }
     }
 
+    inline void fill_flat_lookup(class_type_data::flat_lookup_t& lookup, const class_type_data& data) {
+        for ( const function& function : data.functions ) {
+            lookup.functions.try_emplace(function.get_name(), function);
+        }
+
+        for ( const member& member : data.members ) {
+            lookup.members.try_emplace(member.get_name(), member);
+        }
+
+        for ( const method& method : data.methods ) {
+            lookup.methods.try_emplace(method.get_name(), method);
+        }
+
+        for ( auto&& [name, type] : data.typedefs ) {
+            lookup.typedefs.try_emplace(name, type);
+        }
+
+        for ( const variable& variable : data.variables ) {
+            lookup.variables.try_emplace(variable.get_name(), variable);
+        }
+
+        for ( auto iter{data.base_classes.rbegin()}, end{data.base_classes.rend()}; iter != end; ++iter ) {
+            fill_flat_lookup(lookup, *type_access(*iter));
+        }
+    }
+
+    template < typename... Args >
+    constructor find_viable_constructor(const class_type_data& data, Args&&... args) {
+        type_registry& registry{type_registry::instance()};
+        const std::array<uarg_base, sizeof...(Args)> vargs{uarg_base{registry, META_HPP_FWD(args)}...};
+
+        const auto find_position = [&data, &vargs]() {
+            for ( std::size_t i{}; i < data.constructors.size(); ++i ) {
+                if ( !state_access(data.constructors[i])->create_error(vargs) ) {
+                    return i;
+                }
+            }
+            return overload_cache::npos;
+        };
+
+        std::size_t position{};
+
+        // checking a couple of overloads is cheaper than hashing the arguments
+        if ( data.constructors.size() <= 2 ) {
+            position = find_position();
+        } else {
+            std::array<std::size_t, sizeof...(Args) * 2> shape{};
+            for ( std::size_t i{}; i < vargs.size(); ++i ) {
+                shape[i * 2] = vargs[i].get_raw_type().get_hash();
+                shape[i * 2 + 1] = static_cast<std::size_t>(vargs[i].get_ref_type());
+            }
+
+            if ( const std::optional<std::size_t> cached{data.constructor_overloads.find(shape)} ) {
+                position = *cached;
+            } else {
+                position = find_position();
+                data.constructor_overloads.insert(shape, position);
+            }
+        }
+
+        return position < data.constructors.size() ? data.constructors[position] : constructor{};
+    }
+
     template < class_kind Class >
     any_type_list make_argument_types() {
         using ct = class_traits<Class>;
@@ -115,39 +240,144 @@ namespace meta_hpp::detail
         class_type_data_impl::fill_upcast_info<Class>(new_base_info);
         base_classes.swap(new_base_info.base_classes);
         deep_upcasts.swap(new_base_info.deep_upcasts);
+        upcast_paths.swap(new_base_info.upcast_paths);
+
+        const auto target_less = [](const upcast_func_t& l, const upcast_func_t& r) { return l.target < r.target; };
+        const auto target_equal = [](const upcast_func_t& l, const upcast_func_t& r) { return l.target == r.target; };
+
+        std::stable_sort(deep_upcasts.begin(), deep_upcasts.end(), target_less);
+        deep_upcasts.erase(std::unique(deep_upcasts.begin(), deep_upcasts.end(), target_equal), deep_upcasts.end());
+
+        std::stable_sort(upcast_paths.begin(), upcast_paths.end(), target_less);
+
+        {
+            const type_registry::locker lock;
+
+            for ( const class_type& base : base_classes ) {
+                type_access(base)->derived_classes.push_back(this);
+            }
+
+            flat_lookup_dirty = true;
+            update_flat_lookup();
+        }
+
+        upcast_cache::invalidate();
     }
 
     inline void class_type_data::purge_binds() {
         constructors.clear();
         constructors.shrink_to_fit();
+        constructor_signatures.clear();
+        constructor_overloads.clear();
 
         destructors.clear();
         destructors.shrink_to_fit();
 
         functions.clear();
         functions.shrink_to_fit();
+        function_names.clear();
+        function_signatures.clear();
 
         members.clear();
         members.shrink_to_fit();
+        member_names.clear();
 
         methods.clear();
         methods.shrink_to_fit();
+        method_names.clear();
+        method_signatures.clear();
 
         typedefs.clear();
 
         variables.clear();
         variables.shrink_to_fit();
+        variable_names.clear();
+
+        const type_registry::locker lock;
+        invalidate_flat_lookup();
+        update_flat_lookup();
+
+        // purging isn't concurrent with readers of the class, so replaced tables are freed here
+        release_flat_lookups();
     }
 
     inline void class_type_data::purge_metadata() {
         metadata.clear();
     }
+
+    inline const class_type_data::upcast_func_t* class_type_data::find_upcast(const type_id& target) const noexcept {
+        const auto iter{std::lower_bound( //
+            deep_upcasts.begin(),
+            deep_upcasts.end(),
+            target,
+            [](const upcast_func_t& l, const type_id& r) { return l.target < r; }
+        )};
+        return iter != deep_upcasts.end() && iter->target == target ? std::to_address(iter) : nullptr;
+    }
+
+    inline std::span<const class_type_data::upcast_func_t> class_type_data::find_upcast_paths(const type_id& target) const noexcept {
+        const auto [first, last] = std::equal_range( //
+            upcast_paths.begin(),
+            upcast_paths.end(),
+            upcast_func_t{.target{target}},
+            [](const upcast_func_t& l, const upcast_func_t& r) { return l.target < r.target; }
+        );
+        return {first, last};
+    }
+
+    inline const class_type_data::flat_lookup_t* class_type_data::get_flat_lookup() const noexcept {
+        return flat_lookup.load(std::memory_order_acquire);
+    }
+
+    inline std::size_t class_type_data::get_flat_lookup_version() const noexcept {
+        return flat_lookup_version.load(std::memory_order_acquire);
+    }
+
+    inline void class_type_data::invalidate_flat_lookup() noexcept {
+        // readers fall back to the base classes until the bind publishes a new table
+        flat_lookup.store(nullptr, std::memory_order_release);
+        flat_lookup_version.fetch_add(1, std::memory_order_release);
+        flat_lookup_dirty = true;
+
+        for ( class_type_data* derived : derived_classes ) {
+            derived->invalidate_flat_lookup();
+        }
+    }
+
+    inline void class_type_data::update_flat_lookup() {
+        if ( flat_lookup_dirty ) {
+            auto new_flat_lookup{std::make_unique<flat_lookup_t>()};
+            class_type_data_impl::fill_flat_lookup(*new_flat_lookup, *this);
+
+            flat_lookup_tables.push_back(std::move(new_flat_lookup));
+            flat_lookup.store(flat_lookup_tables.back().get(), std::memory_order_release);
+            flat_lookup_dirty = false;
+        }
+
+        for ( class_type_data* derived : derived_classes ) {
+            derived->update_flat_lookup();
+        }
+    }
+
+    inline void class_type_data::release_flat_lookups() noexcept {
+        if ( flat_lookup_tables.size() > 1 ) {
+            flat_lookup_tables.erase(flat_lookup_tables.begin(), std::prev(flat_lookup_tables.end()));
+        }
+
+        for ( class_type_data* derived : derived_classes ) {
+            derived->release_flat_lookups();
+        }
+    }
 }
 
 namespace meta_hpp::detail
 {
+    inline bool class_type_data::upcast_func_t::is_valid() const noexcept {
+        return has_offset || upcast != nullptr;
+    }
+
     inline void* class_type_data::upcast_func_t::apply(void* ptr) const noexcept {
-        return upcast(ptr);
+        return has_offset ? static_cast<std::byte*>(ptr) + offset : upcast(ptr);
     }
 
     inline const void* class_type_data::upcast_func_t::apply(const void* ptr) const noexcept {
@@ -224,24 +454,22 @@ namespace meta_hpp
 
     template < typename... Args >
     uvalue class_type::create(Args&&... args) const {
-        for ( const constructor& constructor : data_->constructors ) {
-            if ( constructor.is_invocable_with(META_HPP_FWD(args)...) ) {
-                // there is no 'use after move' here because
-                // 'is_invocable_with' doesn't actually move 'args'
-                return constructor.create(META_HPP_FWD(args)...);
-            }
+        using namespace detail;
+        if ( const constructor& constructor = class_type_data_impl::find_viable_constructor(*data_, META_HPP_FWD(args)...) ) {
+            // there is no 'use after move' here because
+            // 'find_viable_constructor' doesn't actually move 'args'
+            return constructor.create(META_HPP_FWD(args)...);
         }
         return uvalue{};
     }
 
     template < typename... Args >
     uvalue class_type::create_at(void* mem, Args&&... args) const {
-        for ( const constructor& constructor : data_->constructors ) {
-            if ( constructor.is_invocable_with(META_HPP_FWD(args)...) ) {
-                // there is no 'use after move' here because
-                // 'is_invocable_with' doesn't actually move 'args'
-                return constructor.create_at(mem, META_HPP_FWD(args)...);
-            }
+        using namespace detail;
+        if ( const constructor& constructor = class_type_data_impl::find_viable_constructor(*data_, META_HPP_FWD(args)...) ) {
+            // there is no 'use after move' here because
+            // 'find_viable_constructor' doesn't actually move 'args'
+            return constructor.create_at(mem, META_HPP_FWD(args)...);
         }
         return uvalue{};
     }
@@ -277,13 +505,7 @@ namespace meta_hpp
             return false;
         }
 
-        for ( const auto& upcast : derived.data_->deep_upcasts ) {
-            if ( upcast.target == *this ) {
-                return true;
-            }
-        }
-
-        return false;
+        return detail::upcast_cache::instance().find_upcast(derived, *this) != nullptr;
     }
 
     template < class_kind Derived >
@@ -324,13 +546,19 @@ namespace meta_hpp
     }
 
     inline function class_type::get_function(std::string_view name, bool recursively) const noexcept {
-        for ( const function& function : data_->functions ) {
-            if ( function.get_name() == name ) {
-                return function;
+        if ( recursively && !data_->base_classes.empty() ) {
+            if ( const auto* flat_lookup{data_->get_flat_lookup()} ) {
+                const auto iter{flat_lookup->functions.find(name)};
+                return iter != flat_lookup->functions.end() ? iter->second : function{};
             }
         }
 
+        if ( const function& function = detail::find_by_name(data_->functions, data_->function_names, name) ) {
+            return function;
+        }
+
         if ( recursively ) {
+            // the flat lookup is cleared while a bind is in progress
             for ( auto iter{data_->base_classes.rbegin()}, end{data_->base_classes.rend()}; iter != end; ++iter ) {
                 if ( const function& function = iter->get_function(name, recursively) ) {
                     return function;
@@ -342,12 +570,17 @@ namespace meta_hpp
     }
 
     inline member class_type::get_member(std::string_view name, bool recursively) const noexcept {
-        for ( const member& member : data_->members ) {
-            if ( member.get_name() == name ) {
-                return member;
+        if ( recursively && !data_->base_classes.empty() ) {
+            if ( const auto* flat_lookup{data_->get_flat_lookup()} ) {
+                const auto iter{flat_lookup->members.find(name)};
+                return iter != flat_lookup->members.end() ? iter->second : member{};
             }
         }
 
+        if ( const member& member = detail::find_by_name(data_->members, data_->member_names, name) ) {
+            return member;
+        }
+
         if ( recursively ) {
             for ( auto iter{data_->base_classes.rbegin()}, end{data_->base_classes.rend()}; iter != end; ++iter ) {
                 if ( const member& member = iter->get_member(name, recursively) ) {
@@ -360,12 +593,17 @@ namespace meta_hpp
     }
 
     inline method class_type::get_method(std::string_view name, bool recursively) const noexcept {
-        for ( const method& method : data_->methods ) {
-            if ( method.get_name() == name ) {
-                return method;
+        if ( recursively && !data_->base_classes.empty() ) {
+            if ( const auto* flat_lookup{data_->get_flat_lookup()} ) {
+                const auto iter{flat_lookup->methods.find(name)};
+                return iter != flat_lookup->methods.end() ? iter->second : method{};
             }
         }
 
+        if ( const method& method = detail::find_by_name(data_->methods, data_->method_names, name) ) {
+            return method;
+        }
+
         if ( recursively ) {
             for ( auto iter{data_->base_classes.rbegin()}, end{data_->base_classes.rend()}; iter != end; ++iter ) {
                 if ( const method& method = iter->get_method(name, recursively) ) {
@@ -378,6 +616,13 @@ namespace meta_hpp
     }
 
     inline any_type class_type::get_typedef(std::string_view name, bool recursively) const noexcept {
+        if ( recursively && !data_->base_classes.empty() ) {
+            if ( const auto* flat_lookup{data_->get_flat_lookup()} ) {
+                const auto iter{flat_lookup->typedefs.find(name)};
+                return iter != flat_lookup->typedefs.end() ? iter->second : any_type{};
+            }
+        }
+
         if ( auto iter{data_->typedefs.find(name)}; iter != data_->typedefs.end() ) {
             return iter->second;
         }
@@ -394,12 +639,17 @@ namespace meta_hpp
     }
 
     inline variable class_type::get_variable(std::string_view name, bool recursively) const noexcept {
-        for ( const variable& variable : data_->variables ) {
-            if ( variable.get_name() == name ) {
-                return variable;
+        if ( recursively && !data_->base_classes.empty() ) {
+            if ( const auto* flat_lookup{data_->get_flat_lookup()} ) {
+                const auto iter{flat_lookup->variables.find(name)};
+                return iter != flat_lookup->variables.end() ? iter->second : variable{};
             }
         }
 
+        if ( const variable& variable = detail::find_by_name(data_->variables, data_->variable_names, name) ) {
+            return variable;
+        }
+
         if ( recursively ) {
             for ( auto iter{data_->base_classes.rbegin()}, end{data_->base_classes.rend()}; iter != end; ++iter ) {
                 if ( const variable& variable = iter->get_variable(name, recursively) ) {
@@ -423,15 +673,15 @@ namespace meta_hpp
 
     template < typename Iter >
     constructor class_type::get_constructor_with(Iter first, Iter last) const {
-        for ( const constructor& constructor : data_->constructors ) {
-            const constructor_type& constructor_type = constructor.get_type();
+        const std::size_t signature{detail::signature_index::make_signature(std::string_view{}, first, last)};
+
+        const std::size_t position{data_->constructor_signatures.find_first(signature, [this, first, last](std::size_t index) {
+            const constructor_type& constructor_type = data_->constructors[index].get_type();
             const any_type_list& constructor_args = constructor_type.get_argument_types();
+            return std::equal(first, last, constructor_args.begin(), constructor_args.end());
+        })};
 
-            if ( std::equal(first, last, constructor_args.begin(), constructor_args.end()) ) {
-                return constructor;
-            }
-        }
-        return constructor{};
+        return position < data_->constructors.size() ? data_->constructors[position] : constructor{};
     }
 
     inline constructor class_type::get_constructor_with(std::span<const any_type> args) const noexcept {
@@ -473,17 +723,21 @@ namespace meta_hpp
         Iter last,
         bool recursively
     ) const {
-        for ( const function& function : data_->functions ) {
+        const std::size_t signature{detail::signature_index::make_signature(name, first, last)};
+
+        const std::size_t position{data_->function_signatures.find_first(signature, [this, name, first, last](std::size_t index) {
+            const function& function = data_->functions[index];
             if ( function.get_name() != name ) {
-                continue;
+                return false;
             }
 
             const function_type& function_type = function.get_type();
             const any_type_list& function_args = function_type.get_argument_types();
+            return std::equal(first, last, function_args.begin(), function_args.end());
+        })};
 
-            if ( std::equal(first, last, function_args.begin(), function_args.end()) ) {
-                return function;
-            }
+        if ( position < data_->functions.size() ) {
+            return data_->functions[position];
         }
 
         if ( recursively ) {
@@ -533,17 +787,21 @@ namespace meta_hpp
         Iter last,
         bool recursively
     ) const {
-        for ( const method& method : data_->methods ) {
+        const std::size_t signature{detail::signature_index::make_signature(name, first, last)};
+
+        const std::size_t position{data_->method_signatures.find_first(signature, [this, name, first, last](std::size_t index) {
+            const method& method = data_->methods[index];
             if ( method.get_name() != name ) {
-                continue;
+                return false;
             }
 
             const method_type& method_type = method.get_type();
             const any_type_list& method_args = method_type.get_argument_types();
+            return std::equal(first, last, method_args.begin(), method_args.end());
+        })};
 
-            if ( std::equal(first, last, method_args.begin(), method_args.end()) ) {
-                return method;
-            }
+        if ( position < data_->methods.size() ) {
+            return data_->methods[position];
         }
 
         if ( recursively ) {
@@ -27,11 +27,48 @@ namespace meta_hpp::detail
     inline void enum_type_data::purge_binds() {
         evalues.clear();
         evalues.shrink_to_fit();
+        evalue_names.clear();
+        evalue_values.clear();
     }
 
     inline void enum_type_data::purge_metadata() {
         metadata.clear();
     }
+
+    inline void enum_type_data::update_value_index() {
+        std::vector<integral_index::entry_type> entries;
+        entries.reserve(evalues.size());
+
+        for ( std::size_t i{}; i < evalues.size(); ++i ) {
+            entries.emplace_back(make_value_key(evalues[i].get_value().get_data()), i);
+        }
+
+        evalue_values.assign(std::move(entries));
+    }
+
+    inline integral_index::key_type enum_type_data::make_value_key(const void* value) const noexcept {
+        const auto read_key = [value]<typename Integral>(type_list<Integral>) {
+            Integral integral{};
+            std::memcpy(&integral, value, sizeof(Integral));
+            return integral_index::make_key(integral);
+        };
+
+        const bool is_signed{underlying_type.get_flags().has(number_flags::is_signed)};
+
+        switch ( underlying_type.get_size() ) {
+        case sizeof(std::uint8_t):
+            return is_signed ? read_key(type_list<std::int8_t>{}) : read_key(type_list<std::uint8_t>{});
+        case sizeof(std::uint16_t):
+            return is_signed ? read_key(type_list<std::int16_t>{}) : read_key(type_list<std::uint16_t>{});
+        case sizeof(std::uint32_t):
+            return is_signed ? read_key(type_list<std::int32_t>{}) : read_key(type_list<std::uint32_t>{});
+        case sizeof(std::uint64_t):
+            return is_signed ? read_key(type_list<std::int64_t>{}) : read_key(type_list<std::uint64_t>{});
+        default:
+            META_HPP_ASSERT(false && "unexpected enum underlying type size");
+            return integral_index::key_type{};
+        }
+    }
 }
 
 namespace meta_hpp
@@ -54,13 +91,8 @@ namespace meta_hpp
             return evalue{};
         }
 
-        for ( const evalue& evalue : data_->evalues ) {
-            if ( evalue.get_value().as<Enum>() == value ) {
-                return evalue;
-            }
-        }
-
-        return evalue{};
+        const std::size_t position{data_->evalue_values.find(detail::integral_index::make_key(detail::to_underlying(value)))};
+        return position < data_->evalues.size() ? data_->evalues[position] : evalue{};
     }
 
     inline evalue enum_type::value_to_evalue(const uvalue& value) const {
@@ -68,21 +100,44 @@ namespace meta_hpp
             return evalue{};
         }
 
-        for ( const evalue& evalue : data_->evalues ) {
-            if ( evalue.get_value().equals(value) ) {
-                return evalue;
-            }
+        const std::size_t position{data_->evalue_values.find(data_->make_value_key(value.get_data()))};
+        return position < data_->evalues.size() ? data_->evalues[position] : evalue{};
+    }
+
+    inline evalue enum_type::name_to_evalue(std::string_view name) const noexcept {
+        return detail::find_by_name(data_->evalues, data_->evalue_names, name);
+    }
+
+    template < enum_kind Enum >
+    std::string_view enum_type::value_to_name(Enum value) const {
+        if ( *this != resolve_type<Enum>() ) {
+            return std::string_view{};
+        }
+
+        const std::size_t position{data_->evalue_values.find(detail::integral_index::make_key(detail::to_underlying(value)))};
+        return position < data_->evalues.size() ? data_->evalues[position].get_name() : std::string_view{};
+    }
+
+    inline std::string_view enum_type::value_to_name(const uvalue& value) const {
+        if ( *this != value.get_type() ) {
+            return std::string_view{};
         }
 
-        return evalue{};
+        const std::size_t position{data_->evalue_values.find(data_->make_value_key(value.get_data()))};
+        return position < data_->evalues.size() ? data_->evalues[position].get_name() : std::string_view{};
     }
 
-    inline evalue enum_type::name_to_evalue(std::string_view name) const noexcept {
-        for ( const evalue& evalue : data_->evalues ) {
-            if ( evalue.get_name() == name ) {
-                return evalue;
-            }
+    template < enum_kind Enum >
+    std::optional<Enum> enum_type::name_to_value(std::string_view name) const {
+        if ( *this != resolve_type<Enum>() ) {
+            return std::nullopt;
         }
-        return evalue{};
+
+        const std::size_t position{data_->evalue_names.find(name)};
+        if ( position < data_->evalues.size() ) {
+            return data_->evalues[position].get_value().as<Enum>();
+        }
+
+        return std::nullopt;
     }
 }
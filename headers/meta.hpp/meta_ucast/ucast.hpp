@@ -11,8 +11,111 @@
 
 #include "../meta_detail/base_info.hpp"
 #include "../meta_detail/type_registry.hpp"
+#include "../meta_detail/upcast_cache.hpp"
 #include "../meta_detail/value_utilities/utraits.hpp"
 
+namespace meta_hpp::detail
+{
+    // Casts a pointer to a base class subobject of the most derived object like
+    // 'dynamic_cast' does. A target class that is ambiguous in the most derived
+    // object is found as the only such subobject containing the source one
+    // (a down-cast) or as a base of the source one (an up-cast), any other
+    // target class is found as a base of the most derived object.
+
+    [[nodiscard]] inline void* pointer_ucast( //
+        void* most_derived_ptr,
+        class_type most_derived_type,
+        void* from_ptr,
+        const class_type& from_type,
+        const class_type& to_type
+    ) {
+        if ( most_derived_type == to_type ) {
+            return most_derived_ptr;
+        }
+
+        const class_type_data::upcast_func_t* upcast = upcast_cache::instance().find_upcast(most_derived_type, to_type);
+
+        if ( upcast == nullptr ) {
+            return nullptr;
+        }
+
+        if ( upcast->is_valid() ) {
+            return upcast->apply(most_derived_ptr);
+        }
+
+        if ( const class_type_data::upcast_func_t* from_upcast = upcast_cache::instance().find_upcast(from_type, to_type);
+             from_upcast != nullptr && from_upcast->is_valid() ) {
+            return from_upcast->apply(from_ptr);
+        }
+
+        void* found_to_ptr{};
+
+        for ( const class_type_data::upcast_func_t& to_path : type_access(most_derived_type)->find_upcast_paths(to_type.get_id()) ) {
+            if ( !to_path.is_valid() ) {
+                return nullptr;
+            }
+
+            void* to_ptr = to_path.apply(most_derived_ptr);
+
+            if ( to_ptr == found_to_ptr ) {
+                continue;
+            }
+
+            for ( const class_type_data::upcast_func_t& from_path : type_access(to_type)->find_upcast_paths(from_type.get_id()) ) {
+                if ( !from_path.is_valid() ) {
+                    return nullptr;
+                }
+
+                if ( from_path.apply(to_ptr) == from_ptr ) {
+                    if ( found_to_ptr != nullptr ) {
+                        return nullptr;
+                    }
+
+                    found_to_ptr = to_ptr;
+                    break;
+                }
+            }
+        }
+
+        return found_to_ptr;
+    }
+}
+
+namespace meta_hpp::detail
+{
+    // Subobject offsets depend only on the most derived type, so a ucast result is
+    // remembered as a pair of offsets from the most derived object per call site.
+
+    struct ucast_cache_entry final {
+        type_id most_derived_id{};
+        std::ptrdiff_t from_offset{};
+        std::ptrdiff_t to_offset{};
+        bool succeeded{};
+    };
+
+    [[nodiscard]] inline std::ptrdiff_t pointer_offset(const void* base_ptr, const void* ptr) noexcept {
+        return static_cast<const std::byte*>(ptr) - static_cast<const std::byte*>(base_ptr);
+    }
+
+    [[nodiscard]] inline void* pointer_ucast( //
+        ucast_cache_entry& cache,
+        void* most_derived_ptr,
+        class_type most_derived_type,
+        void* from_ptr,
+        const class_type& from_type,
+        const class_type& to_type
+    ) {
+        void* to_ptr = pointer_ucast(most_derived_ptr, most_derived_type, from_ptr, from_type, to_type);
+
+        cache.most_derived_id = most_derived_type.get_id();
+        cache.from_offset = pointer_offset(most_derived_ptr, from_ptr);
+        cache.to_offset = to_ptr != nullptr ? pointer_offset(most_derived_ptr, to_ptr) : 0;
+        cache.succeeded = to_ptr != nullptr;
+
+        return to_ptr;
+    }
+}
+
 namespace meta_hpp
 {
     template < typename To, typename From >
@@ -46,8 +149,26 @@ namespace meta_hpp
             if constexpr ( std::is_void_v<to_data_type> ) {
                 return most_derived_object_ptr;
             } else {
-                const class_type& to_class_type = registry.resolve_by_type<to_data_type>();
-                return static_cast<To>(detail::pointer_upcast(most_derived_object_ptr, meta_info.type, to_class_type));
+                thread_local detail::ucast_cache_entry cache;
+
+                // type identities are compared instead of indices, objects may come
+                // from shared libraries that index their types with own registries
+                if ( cache.most_derived_id == meta_info.type.get_id()
+                     && cache.from_offset == detail::pointer_offset(most_derived_object_ptr, from) ) {
+                    return cache.succeeded //
+                             ? static_cast<To>(static_cast<void*>(static_cast<std::byte*>(most_derived_object_ptr) + cache.to_offset))
+                             : nullptr;
+                }
+
+                return static_cast<To>(detail::pointer_ucast(
+                    cache,
+                    most_derived_object_ptr,
+                    meta_info.type,
+                    // NOLINTNEXTLINE(*-const-cast)
+                    const_cast<from_data_type*>(from),
+                    registry.resolve_by_type<from_data_type>(),
+                    registry.resolve_by_type<to_data_type>()
+                ));
             }
         }
     }
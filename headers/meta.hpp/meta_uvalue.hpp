@@ -9,6 +9,60 @@
 #include "meta_base.hpp"
 #include "meta_details.hpp"
 
+namespace meta_hpp
+{
+    class uvalue_memory_resource {
+    public:
+        uvalue_memory_resource() = default;
+        virtual ~uvalue_memory_resource() = default;
+
+        uvalue_memory_resource(uvalue_memory_resource&&) = delete;
+        uvalue_memory_resource& operator=(uvalue_memory_resource&&) = delete;
+
+        uvalue_memory_resource(const uvalue_memory_resource&) = delete;
+        uvalue_memory_resource& operator=(const uvalue_memory_resource&) = delete;
+
+        [[nodiscard]] void* allocate(std::size_t size, std::size_t align);
+        void deallocate(void* ptr, std::size_t size, std::size_t align) noexcept;
+
+    protected:
+        [[nodiscard]] virtual void* do_allocate(std::size_t size, std::size_t align) = 0;
+        virtual void do_deallocate(void* ptr, std::size_t size, std::size_t align) noexcept = 0;
+    };
+
+    class uvalue_pool_resource final : public uvalue_memory_resource {
+    public:
+        static constexpr std::size_t min_block_size{16};
+        static constexpr std::size_t max_block_size{512};
+        static constexpr std::size_t blocks_per_chunk{64};
+
+        uvalue_pool_resource() = default;
+        ~uvalue_pool_resource() override;
+
+    protected:
+        [[nodiscard]] void* do_allocate(std::size_t size, std::size_t align) override;
+        void do_deallocate(void* ptr, std::size_t size, std::size_t align) noexcept override;
+
+    private:
+        struct free_block final {
+            free_block* next;
+        };
+
+        static constexpr std::size_t size_class_count{std::bit_width(max_block_size / min_block_size)};
+
+        [[nodiscard]] static std::size_t get_size_class(std::size_t size) noexcept;
+
+    private:
+        std::mutex mutex_;
+        std::array<free_block*, size_class_count> free_lists_{};
+        std::vector<void*> chunks_;
+    };
+
+    [[nodiscard]] uvalue_memory_resource* get_uvalue_resource() noexcept;
+    uvalue_memory_resource* set_uvalue_resource(uvalue_memory_resource* resource) noexcept;
+    uvalue_memory_resource* set_thread_uvalue_resource(uvalue_memory_resource* resource) noexcept;
+}
+
 namespace meta_hpp
 {
     class uvalue final {
@@ -53,6 +107,13 @@ namespace meta_hpp
             requires std::is_constructible_v<std::decay_t<T>, std::initializer_list<U>&, Args...>
         std::decay_t<T>& emplace(std::initializer_list<U> ilist, Args&&... args);
 
+        template <                                            //
+            typename T,                                       //
+            typename = std::enable_if_t<                      //
+                !uvalue_family<std::decay_t<T>> &&            //
+                std::is_constructible_v<std::decay_t<T>, T>>> //
+        std::decay_t<T>& assign(T&& val);
+
         [[nodiscard]] bool has_value() const noexcept;
         [[nodiscard]] explicit operator bool() const noexcept;
 
@@ -61,9 +122,9 @@ namespace meta_hpp
 
         [[nodiscard]] any_type get_type() const noexcept;
 
-        [[nodiscard]] void* get_data() noexcept;
         [[nodiscard]] const void* get_data() const noexcept;
         [[nodiscard]] const void* get_cdata() const noexcept;
+        [[nodiscard]] void* get_mutable_data();
 
         [[nodiscard]] uvalue operator*() const;
         [[nodiscard]] bool has_deref_op() const noexcept;
@@ -74,6 +135,10 @@ namespace meta_hpp
         [[nodiscard]] uvalue copy() const;
         [[nodiscard]] bool has_copy_op() const noexcept;
 
+        [[nodiscard]] uvalue share();
+        [[nodiscard]] bool is_shared() const noexcept;
+        void unshare();
+
         [[nodiscard]] uvalue unmap() const;
         [[nodiscard]] bool has_unmap_op() const noexcept;
 
@@ -119,15 +184,36 @@ namespace meta_hpp
 
     private:
         struct vtable_t;
+        struct shared_block_base;
+
+        template < typename T, typename... Args >
+        friend uvalue make_shared_uvalue(Args&&... args);
+
+        template < typename T, typename U, typename... Args >
+        friend uvalue make_shared_uvalue(std::initializer_list<U> ilist, Args&&... args);
+
+        // values that fit this buffer are stored without allocations,
+        // wider buffers trade the size of every uvalue for fewer of them
+        static constexpr std::size_t internal_storage_size{META_HPP_UVALUE_INLINE_SIZE};
+        static constexpr std::size_t internal_storage_align{META_HPP_UVALUE_INLINE_ALIGN};
+
+        static_assert(internal_storage_size > sizeof(void*), "the uvalue inline buffer must be wider than a pointer");
+        static_assert(std::has_single_bit(internal_storage_align), "the uvalue inline alignment must be a power of two");
+        static_assert(internal_storage_align >= alignof(void*), "the uvalue inline alignment must fit a pointer");
 
-        struct alignas(std::max_align_t) internal_storage_t final {
+        struct alignas(internal_storage_align) internal_storage_t final {
             // NOLINTNEXTLINE(*-avoid-c-arrays)
-            std::byte data[sizeof(void*) * 3];
+            std::byte data[internal_storage_size];
         };
 
         struct external_storage_t final {
-            // NOLINTNEXTLINE(*-avoid-c-arrays)
-            std::byte padding[sizeof(internal_storage_t) - sizeof(void*)];
+            // nullptr when the value is allocated by the global operator new
+            uvalue_memory_resource* resource;
+            void* ptr;
+        };
+
+        struct shared_storage_t final {
+            shared_block_base* block;
             void* ptr;
         };
 
@@ -136,6 +222,7 @@ namespace meta_hpp
             trivial,
             internal,
             external,
+            shared,
         };
 
         // NOLINTNEXTLINE(*-union-access)
@@ -143,14 +230,16 @@ namespace meta_hpp
             union {
                 internal_storage_t internal;
                 external_storage_t external;
+                shared_storage_t shared;
             };
 
             std::uintptr_t vtag;
         } storage_{};
 
         static_assert(std::is_standard_layout_v<storage_u>);
-        static_assert(alignof(storage_u) == alignof(std::max_align_t));
-        static_assert(sizeof(internal_storage_t) == sizeof(external_storage_t));
+        static_assert(alignof(storage_u) == internal_storage_align);
+        static_assert(sizeof(internal_storage_t) >= sizeof(external_storage_t));
+        static_assert(sizeof(internal_storage_t) >= sizeof(shared_storage_t));
     };
 
     inline void swap(uvalue& l, uvalue& r) noexcept {
@@ -166,4 +255,10 @@ namespace meta_hpp
     [[nodiscard]] uvalue make_uvalue(std::initializer_list<U> ilist, Args&&... args) {
         return uvalue(std::in_place_type<T>, ilist, std::forward<Args>(args)...);
     }
+
+    template < typename T, typename... Args >
+    [[nodiscard]] uvalue make_shared_uvalue(Args&&... args);
+
+    template < typename T, typename U, typename... Args >
+    [[nodiscard]] uvalue make_shared_uvalue(std::initializer_list<U> ilist, Args&&... args);
 }
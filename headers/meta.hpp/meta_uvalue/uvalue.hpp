@@ -9,6 +9,7 @@
 #include "../meta_base.hpp"
 #include "../meta_registry.hpp"
 #include "../meta_uvalue.hpp"
+#include "../meta_uvalue/uvalue_resource.hpp"
 
 #include "../meta_detail/value_traits/copy_traits.hpp"
 #include "../meta_detail/value_traits/deref_traits.hpp"
@@ -23,13 +24,27 @@
 
 namespace meta_hpp
 {
-    struct uvalue::vtable_t final {
+    struct uvalue::shared_block_base {
+        std::atomic<std::size_t> refs{1};
+        uvalue_memory_resource* resource{};
+
+        explicit shared_block_base(uvalue_memory_resource* nresource) noexcept
+        : resource{nresource} {}
+    };
+
+    // the vtable pointer is packed with a storage tag of 3 bits
+    struct alignas(8) uvalue::vtable_t final {
         // NOLINTBEGIN(*-avoid-const-or-ref-data-members)
         const any_type type;
+        const storage_e storage;
 
         void (*const move)(uvalue&& self, uvalue& to) noexcept;
         void (*const reset)(uvalue& self) noexcept;
 
+        void (*const share)(uvalue& self);
+        void (*const unshare)(uvalue& self);
+        void (*const destroy_shared)(shared_block_base* block) noexcept;
+
         uvalue (*const index)(const storage_u& self, std::size_t i);
         std::size_t (*const size)(const storage_u& self);
 
@@ -41,6 +56,16 @@ namespace meta_hpp
         bool (*const equals)(const storage_u& l, const storage_u& r);
         // NOLINTEND(*-avoid-const-or-ref-data-members)
 
+        template < typename Tp >
+        struct shared_block final : shared_block_base {
+            Tp value;
+
+            template < typename... Args >
+            explicit shared_block(uvalue_memory_resource* nresource, Args&&... args)
+            : shared_block_base{nresource}
+            , value(std::forward<Args>(args)...) {}
+        };
+
         template < typename T >
         static constexpr bool in_internal_v = //
             (sizeof(T) <= sizeof(internal_storage_t)) && (alignof(internal_storage_t) % alignof(T) == 0)
@@ -50,8 +75,13 @@ namespace meta_hpp
         static constexpr bool in_trivial_internal_v = //
             in_internal_v<T> && std::is_trivially_copyable_v<T>;
 
+        template < typename T >
+        static constexpr storage_e storage_v = //
+            in_trivial_internal_v<T> ? storage_e::trivial : in_internal_v<T> ? storage_e::internal : storage_e::external;
+
+        static constexpr std::uintptr_t tag_mask{0b111};
+
         static std::pair<storage_e, const vtable_t*> unpack_vtag(const uvalue& self) noexcept {
-            constexpr std::uintptr_t tag_mask{0b11};
             const std::uintptr_t vtag{self.storage_.vtag};
             return std::make_pair(
                 static_cast<storage_e>(vtag & tag_mask),
@@ -60,8 +90,23 @@ namespace meta_hpp
             );
         }
 
+        static bool is_shared_storage(const storage_u& storage) noexcept {
+            return static_cast<storage_e>(storage.vtag & tag_mask) == storage_e::shared;
+        }
+
+        // shared values of any type are kept in a block outside of the storage,
+        // so the original storage of the type is used only for unique values
+        static storage_e get_value_storage(storage_e tag, const vtable_t* vtable) noexcept {
+            return tag == storage_e::shared ? vtable->storage : tag;
+        }
+
         template < typename T >
         static T* storage_cast(storage_u& storage) noexcept {
+            if ( is_shared_storage(storage) ) {
+                // NOLINTNEXTLINE(*-union-access)
+                return static_cast<T*>(storage.shared.ptr);
+            }
+
             if constexpr ( in_internal_v<T> ) {
                 // NOLINTNEXTLINE(*-union-access, *-reinterpret-cast)
                 return std::launder(reinterpret_cast<T*>(storage.internal.data));
@@ -73,6 +118,11 @@ namespace meta_hpp
 
         template < typename T >
         static const T* storage_cast(const storage_u& storage) noexcept {
+            if ( is_shared_storage(storage) ) {
+                // NOLINTNEXTLINE(*-union-access)
+                return static_cast<const T*>(storage.shared.ptr);
+            }
+
             if constexpr ( in_internal_v<T> ) {
                 // NOLINTNEXTLINE(*-union-access, *-reinterpret-cast)
                 return std::launder(reinterpret_cast<const T*>(storage.internal.data));
@@ -88,11 +138,30 @@ namespace meta_hpp
 
             if constexpr ( in_internal_v<Tp> ) {
                 std::construct_at(storage_cast<Tp>(dst.storage_), std::forward<Args>(args)...);
-                dst.storage_.vtag = in_trivial_internal_v<Tp> ? detail::to_underlying(storage_e::trivial)
-                                                              : detail::to_underlying(storage_e::internal);
+                dst.storage_.vtag = detail::to_underlying(storage_v<Tp>);
             } else {
-                // NOLINTNEXTLINE(*-union-access, *-owning-memory)
-                dst.storage_.external.ptr = new Tp(std::forward<Args>(args)...);
+                // the resource is kept with the value, so it is freed by the same
+                // resource even if the current one is changed or it's another thread
+                uvalue_memory_resource* resource{get_uvalue_resource()};
+                void* mem{detail::uvalue_allocate(resource, sizeof(Tp), alignof(Tp))};
+
+                // NOLINTNEXTLINE(*-special-member-functions)
+                struct allocation_guard final {
+                    uvalue_memory_resource* resource;
+                    void* mem;
+
+                    ~allocation_guard() noexcept {
+                        detail::uvalue_deallocate(resource, mem, sizeof(Tp), alignof(Tp));
+                    }
+                } guard{resource, mem};
+
+                std::construct_at(static_cast<Tp*>(mem), std::forward<Args>(args)...);
+                guard.mem = nullptr;
+
+                // NOLINTBEGIN(*-union-access)
+                dst.storage_.external.resource = resource;
+                dst.storage_.external.ptr = mem;
+                // NOLINTEND(*-union-access)
                 dst.storage_.vtag = detail::to_underlying(storage_e::external);
             }
 
@@ -101,6 +170,62 @@ namespace meta_hpp
             return *storage_cast<Tp>(dst.storage_);
         }
 
+        template < typename T, typename... Args, typename Tp = std::decay_t<T> >
+        static Tp& do_shared_ctor(uvalue& dst, Args&&... args) {
+            META_HPP_DEV_ASSERT(!dst);
+
+            using block_t = shared_block<Tp>;
+
+            uvalue_memory_resource* resource{get_uvalue_resource()};
+            void* mem{detail::uvalue_allocate(resource, sizeof(block_t), alignof(block_t))};
+
+            // NOLINTNEXTLINE(*-special-member-functions)
+            struct allocation_guard final {
+                uvalue_memory_resource* resource;
+                void* mem;
+
+                ~allocation_guard() noexcept {
+                    detail::uvalue_deallocate(resource, mem, sizeof(block_t), alignof(block_t));
+                }
+            } guard{resource, mem};
+
+            block_t* block{std::construct_at(static_cast<block_t*>(mem), resource, std::forward<Args>(args)...)};
+            guard.mem = nullptr;
+
+            // NOLINTBEGIN(*-union-access)
+            dst.storage_.shared.block = block;
+            dst.storage_.shared.ptr = std::addressof(block->value);
+            // NOLINTEND(*-union-access)
+
+            // NOLINTNEXTLINE(*-reinterpret-cast)
+            dst.storage_.vtag = detail::to_underlying(storage_e::shared) | reinterpret_cast<std::uintptr_t>(vtable_t::get<Tp>());
+            return block->value;
+        }
+
+        static void do_share(const uvalue& self, uvalue& to) noexcept {
+            META_HPP_DEV_ASSERT(!to);
+            META_HPP_DEV_ASSERT(is_shared_storage(self.storage_));
+
+            // NOLINTNEXTLINE(*-union-access)
+            self.storage_.shared.block->refs.fetch_add(1, std::memory_order_relaxed);
+            to.storage_ = self.storage_;
+        }
+
+        template < typename T, typename Tp = std::decay_t<T> >
+        static Tp& do_assign(uvalue& dst, T&& val) {
+            // reuses the held value (and its external buffer) when the types match
+            if constexpr ( std::is_assignable_v<Tp&, T> ) {
+                if ( unpack_vtag(dst) == std::make_pair(storage_v<Tp>, static_cast<const vtable_t*>(vtable_t::get<Tp>())) ) {
+                    Tp& dst_val = *storage_cast<Tp>(dst.storage_);
+                    dst_val = std::forward<T>(val);
+                    return dst_val;
+                }
+            }
+
+            do_reset(dst);
+            return do_ctor<T>(dst, std::forward<T>(val));
+        }
+
         static void do_move(uvalue&& self, uvalue& to) noexcept {
             META_HPP_DEV_ASSERT(!to);
 
@@ -110,6 +235,7 @@ namespace meta_hpp
             case storage_e::nothing:
                 break;
             case storage_e::trivial:
+            case storage_e::shared:
                 to.storage_ = self.storage_;
                 self.storage_.vtag = 0;
                 break;
@@ -133,6 +259,16 @@ namespace meta_hpp
             case storage_e::external:
                 vtable->reset(self);
                 break;
+            case storage_e::shared: {
+                // NOLINTNEXTLINE(*-union-access)
+                shared_block_base* block{self.storage_.shared.block};
+                self.storage_.vtag = 0;
+
+                if ( block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1 ) {
+                    vtable->destroy_shared(block);
+                }
+                break;
+            }
             }
         }
 
@@ -169,6 +305,7 @@ namespace meta_hpp
 
             static vtable_t table{
                 .type = resolve_type<Tp>(),
+                .storage = storage_v<Tp>,
 
                 // NOLINTNEXTLINE(*-param-not-moved)
                 .move{[](uvalue&& self, uvalue& to) noexcept {
@@ -182,7 +319,7 @@ namespace meta_hpp
                         do_reset(self);
                     } else {
                         // NOLINTNEXTLINE(*-union-access)
-                        to.storage_.external.ptr = src;
+                        to.storage_.external = self.storage_.external;
                         std::swap(to.storage_.vtag, self.storage_.vtag);
                     }
                 }},
@@ -195,13 +332,72 @@ namespace meta_hpp
                     if constexpr ( in_internal_v<Tp> ) {
                         std::destroy_at(src);
                     } else {
-                        // NOLINTNEXTLINE(*-owning-memory)
-                        delete src;
+                        std::destroy_at(src);
+                        // NOLINTNEXTLINE(*-union-access)
+                        detail::uvalue_deallocate(self.storage_.external.resource, src, sizeof(Tp), alignof(Tp));
                     }
 
                     self.storage_.vtag = 0;
                 }},
 
+                .share{[]() {
+                    if constexpr ( detail::has_copy_traits<Tp> ) {
+                        return +[](uvalue& self) {
+                            META_HPP_DEV_ASSERT(self && !self.is_shared());
+
+                            uvalue tmp;
+                            Tp* src = storage_cast<Tp>(self.storage_);
+
+                            if constexpr ( std::is_move_constructible_v<Tp> ) {
+                                do_shared_ctor<Tp>(tmp, std::move(*src));
+                            } else {
+                                do_shared_ctor<Tp>(tmp, std::as_const(*src));
+                            }
+
+                            do_reset(self);
+                            do_move(std::move(tmp), self);
+                        };
+                    } else {
+                        return nullptr;
+                    }
+                }()},
+
+                .unshare{[]() {
+                    if constexpr ( detail::has_copy_traits<Tp> ) {
+                        return +[](uvalue& self) {
+                            META_HPP_DEV_ASSERT(self.is_shared());
+
+                            uvalue tmp;
+                            Tp* src = storage_cast<Tp>(self.storage_);
+
+                            // the last owner can steal the value instead of copying it
+                            // NOLINTNEXTLINE(*-union-access)
+                            if ( self.storage_.shared.block->refs.load(std::memory_order_acquire) == 1 ) {
+                                if constexpr ( std::is_move_constructible_v<Tp> ) {
+                                    do_ctor<Tp>(tmp, std::move(*src));
+                                } else {
+                                    do_ctor<Tp>(tmp, std::as_const(*src));
+                                }
+                            } else {
+                                do_ctor<Tp>(tmp, std::as_const(*src));
+                            }
+
+                            do_reset(self);
+                            do_move(std::move(tmp), self);
+                        };
+                    } else {
+                        return nullptr;
+                    }
+                }()},
+
+                .destroy_shared{[](shared_block_base* base) noexcept {
+                    auto* block = static_cast<shared_block<Tp>*>(base);
+                    uvalue_memory_resource* resource{block->resource};
+
+                    std::destroy_at(block);
+                    detail::uvalue_deallocate(resource, block, sizeof(shared_block<Tp>), alignof(shared_block<Tp>));
+                }},
+
                 .index{[]() {
                     if constexpr ( detail::has_index_traits<Tp> ) {
                         return +[](const storage_u& self, std::size_t i) -> uvalue {
@@ -332,6 +528,11 @@ namespace meta_hpp
         return vtable_t::do_ctor<T>(*this, ilist, std::forward<Args>(args)...);
     }
 
+    template < typename T, typename >
+    std::decay_t<T>& uvalue::assign(T&& val) {
+        return vtable_t::do_assign<T>(*this, std::forward<T>(val));
+    }
+
     inline bool uvalue::has_value() const noexcept {
         return storage_.vtag != 0;
     }
@@ -353,23 +554,6 @@ namespace meta_hpp
         return tag == storage_e::nothing ? any_type{} : vtable->type;
     }
 
-    inline void* uvalue::get_data() noexcept {
-        switch ( vtable_t::unpack_vtag(*this).first ) {
-        case storage_e::nothing:
-            return nullptr;
-        case storage_e::trivial:
-        case storage_e::internal:
-            // NOLINTNEXTLINE(*-union-access)
-            return static_cast<void*>(storage_.internal.data);
-        case storage_e::external:
-            // NOLINTNEXTLINE(*-union-access)
-            return storage_.external.ptr;
-        }
-
-        META_HPP_ASSERT(false);
-        return nullptr;
-    }
-
     inline const void* uvalue::get_data() const noexcept {
         switch ( vtable_t::unpack_vtag(*this).first ) {
         case storage_e::nothing:
@@ -381,6 +565,9 @@ namespace meta_hpp
         case storage_e::external:
             // NOLINTNEXTLINE(*-union-access)
             return storage_.external.ptr;
+        case storage_e::shared:
+            // NOLINTNEXTLINE(*-union-access)
+            return storage_.shared.ptr;
         }
 
         META_HPP_ASSERT(false);
@@ -388,20 +575,15 @@ namespace meta_hpp
     }
 
     inline const void* uvalue::get_cdata() const noexcept {
-        switch ( vtable_t::unpack_vtag(*this).first ) {
-        case storage_e::nothing:
-            return nullptr;
-        case storage_e::trivial:
-        case storage_e::internal:
-            // NOLINTNEXTLINE(*-union-access)
-            return static_cast<const void*>(storage_.internal.data);
-        case storage_e::external:
-            // NOLINTNEXTLINE(*-union-access)
-            return storage_.external.ptr;
-        }
+        return get_data();
+    }
 
-        META_HPP_ASSERT(false);
-        return nullptr;
+    inline void* uvalue::get_mutable_data() {
+        // shared values are immutable, so they are detached before any write
+        unshare();
+
+        // NOLINTNEXTLINE(*-const-cast)
+        return const_cast<void*>(get_data());
     }
 
     inline uvalue uvalue::operator*() const {
@@ -441,6 +623,12 @@ namespace meta_hpp
             return uvalue{};
         }
 
+        if ( tag == storage_e::shared ) {
+            uvalue result;
+            vtable_t::do_share(*this, result);
+            return result;
+        }
+
         if ( vtable->copy != nullptr ) {
             return vtable->copy(storage_);
         }
@@ -450,7 +638,45 @@ namespace meta_hpp
 
     inline bool uvalue::has_copy_op() const noexcept {
         auto&& [tag, vtable] = vtable_t::unpack_vtag(*this);
-        return tag == storage_e::nothing || vtable->copy != nullptr;
+        return tag == storage_e::nothing || tag == storage_e::shared || vtable->copy != nullptr;
+    }
+
+    inline uvalue uvalue::share() {
+        auto&& [tag, vtable] = vtable_t::unpack_vtag(*this);
+
+        if ( tag == storage_e::nothing ) {
+            return uvalue{};
+        }
+
+        if ( tag != storage_e::shared ) {
+            if ( vtable->share == nullptr ) {
+                throw_exception(error_code::bad_uvalue_operation);
+            }
+
+            vtable->share(*this);
+        }
+
+        uvalue result;
+        vtable_t::do_share(*this, result);
+        return result;
+    }
+
+    inline bool uvalue::is_shared() const noexcept {
+        return vtable_t::unpack_vtag(*this).first == storage_e::shared;
+    }
+
+    inline void uvalue::unshare() {
+        auto&& [tag, vtable] = vtable_t::unpack_vtag(*this);
+
+        if ( tag != storage_e::shared ) {
+            return;
+        }
+
+        if ( vtable->unshare == nullptr ) {
+            throw_exception(error_code::bad_uvalue_operation);
+        }
+
+        vtable->unshare(*this);
     }
 
     inline uvalue uvalue::unmap() const {
@@ -491,6 +717,10 @@ namespace meta_hpp
         auto&& [l_tag, l_vtable] = vtable_t::unpack_vtag(*this);
         auto&& [r_tag, r_vtable] = vtable_t::unpack_vtag(other);
 
+        // shared values are ordered with the unique values of the same type
+        l_tag = vtable_t::get_value_storage(l_tag, l_vtable);
+        r_tag = vtable_t::get_value_storage(r_tag, r_vtable);
+
         if ( l_tag != r_tag || l_tag == storage_e::nothing ) {
             return l_tag < r_tag;
         }
@@ -519,6 +749,10 @@ namespace meta_hpp
         auto&& [l_tag, l_vtable] = vtable_t::unpack_vtag(*this);
         auto&& [r_tag, r_vtable] = vtable_t::unpack_vtag(other);
 
+        // shared values are equal to the unique values of the same type
+        l_tag = vtable_t::get_value_storage(l_tag, l_vtable);
+        r_tag = vtable_t::get_value_storage(r_tag, r_vtable);
+
         if ( l_tag != r_tag || l_tag == storage_e::nothing ) {
             return l_tag == r_tag;
         }
@@ -571,6 +805,12 @@ namespace meta_hpp
     T& uvalue::as() & {
         static_assert(std::is_same_v<T, std::decay_t<T>>);
 
+        // shared values are detached for a mutable access, but only
+        // when the type matches, so a failed access leaves them shared
+        if ( is_shared() && std::as_const(*this).try_as<T>() != nullptr ) {
+            unshare();
+        }
+
         if ( T* ptr = try_as<T>() ) {
             return *ptr;
         }
@@ -593,6 +833,10 @@ namespace meta_hpp
     T uvalue::as() && {
         static_assert(std::is_same_v<T, std::decay_t<T>>);
 
+        if ( is_shared() && std::as_const(*this).try_as<T>() != nullptr ) {
+            unshare();
+        }
+
         if ( T* ptr = try_as<T>() ) {
             return std::move(*ptr);
         }
@@ -646,6 +890,9 @@ namespace meta_hpp
         using namespace detail;
         type_registry& registry{type_registry::instance()};
 
+        // shared values are immutable and detaching them can fail, so they are
+        // cast as constant ones here and detached by 'as', 'get_mutable_data'
+        // or 'unshare' only
         if ( const uarg varg{registry, *this}; varg.can_cast_to<T&>(registry) ) {
             return std::addressof(varg.cast<T&>(registry));
         }
@@ -667,3 +914,24 @@ namespace meta_hpp
         return nullptr;
     }
 }
+
+namespace meta_hpp
+{
+    template < typename T, typename... Args >
+    uvalue make_shared_uvalue(Args&&... args) {
+        static_assert(detail::has_copy_traits<std::decay_t<T>>, "shared values are copied on write by copy_traits");
+
+        uvalue result;
+        uvalue::vtable_t::do_shared_ctor<T>(result, std::forward<Args>(args)...);
+        return result;
+    }
+
+    template < typename T, typename U, typename... Args >
+    uvalue make_shared_uvalue(std::initializer_list<U> ilist, Args&&... args) {
+        static_assert(detail::has_copy_traits<std::decay_t<T>>, "shared values are copied on write by copy_traits");
+
+        uvalue result;
+        uvalue::vtable_t::do_shared_ctor<T>(result, ilist, std::forward<Args>(args)...);
+        return result;
+    }
+}
@@ -0,0 +1,152 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "../meta_base.hpp"
+#include "../meta_uvalue.hpp"
+
+namespace meta_hpp::detail
+{
+    [[nodiscard]] inline void* default_uvalue_allocate(std::size_t size, std::size_t align) {
+        if ( align > __STDCPP_DEFAULT_NEW_ALIGNMENT__ ) {
+            return ::operator new(size, std::align_val_t{align});
+        }
+        return ::operator new(size);
+    }
+
+    inline void default_uvalue_deallocate(void* ptr, std::size_t align) noexcept {
+        if ( align > __STDCPP_DEFAULT_NEW_ALIGNMENT__ ) {
+            ::operator delete(ptr, std::align_val_t{align});
+        } else {
+            ::operator delete(ptr);
+        }
+    }
+
+    [[nodiscard]] inline void* uvalue_allocate(uvalue_memory_resource* resource, std::size_t size, std::size_t align) {
+        return resource != nullptr ? resource->allocate(size, align) : default_uvalue_allocate(size, align);
+    }
+
+    inline void uvalue_deallocate(uvalue_memory_resource* resource, void* ptr, std::size_t size, std::size_t align) noexcept {
+        if ( resource != nullptr ) {
+            resource->deallocate(ptr, size, align);
+        } else {
+            default_uvalue_deallocate(ptr, align);
+        }
+    }
+
+    struct uvalue_resource_state final {
+        [[nodiscard]] static std::atomic<uvalue_memory_resource*>& global() noexcept {
+            static std::atomic<uvalue_memory_resource*> resource{};
+            return resource;
+        }
+
+        [[nodiscard]] static uvalue_memory_resource*& thread() noexcept {
+            thread_local uvalue_memory_resource* resource{};
+            return resource;
+        }
+    };
+}
+
+namespace meta_hpp
+{
+    inline void* uvalue_memory_resource::allocate(std::size_t size, std::size_t align) {
+        META_HPP_DEV_ASSERT(std::has_single_bit(align));
+        return do_allocate(size, align);
+    }
+
+    inline void uvalue_memory_resource::deallocate(void* ptr, std::size_t size, std::size_t align) noexcept {
+        if ( ptr != nullptr ) {
+            do_deallocate(ptr, size, align);
+        }
+    }
+}
+
+namespace meta_hpp
+{
+    inline uvalue_pool_resource::~uvalue_pool_resource() {
+        for ( void* chunk : chunks_ ) {
+            ::operator delete(chunk);
+        }
+    }
+
+    inline void* uvalue_pool_resource::do_allocate(std::size_t size, std::size_t align) {
+        const std::size_t size_class{get_size_class(size)};
+
+        if ( size_class == size_class_count || align > __STDCPP_DEFAULT_NEW_ALIGNMENT__ ) {
+            return detail::default_uvalue_allocate(size, align);
+        }
+
+        const std::lock_guard lock{mutex_};
+
+        free_block*& free_list = free_lists_[size_class];
+
+        if ( free_list == nullptr ) {
+            const std::size_t block_size{min_block_size << size_class};
+
+            // blocks of a new chunk are linked into the free list at once,
+            // a chunk is only returned to the system with the whole pool
+            chunks_.reserve(chunks_.size() + 1);
+            void* chunk = ::operator new(block_size * blocks_per_chunk);
+            chunks_.push_back(chunk);
+
+            for ( std::size_t i{blocks_per_chunk}; i > 0; --i ) {
+                void* block = static_cast<std::byte*>(chunk) + block_size * (i - 1);
+                free_list = std::construct_at(static_cast<free_block*>(block), free_list);
+            }
+        }
+
+        free_block* block = free_list;
+        free_list = block->next;
+        return block;
+    }
+
+    inline void uvalue_pool_resource::do_deallocate(void* ptr, std::size_t size, std::size_t align) noexcept {
+        const std::size_t size_class{get_size_class(size)};
+
+        if ( size_class == size_class_count || align > __STDCPP_DEFAULT_NEW_ALIGNMENT__ ) {
+            detail::default_uvalue_deallocate(ptr, align);
+            return;
+        }
+
+        const std::lock_guard lock{mutex_};
+
+        free_block*& free_list = free_lists_[size_class];
+        free_list = std::construct_at(static_cast<free_block*>(ptr), free_list);
+    }
+
+    inline std::size_t uvalue_pool_resource::get_size_class(std::size_t size) noexcept {
+        if ( size > max_block_size ) {
+            return size_class_count;
+        }
+
+        const std::size_t block_size{std::bit_ceil(std::max(size, min_block_size))};
+        return static_cast<std::size_t>(std::countr_zero(block_size / min_block_size));
+    }
+}
+
+namespace meta_hpp
+{
+    inline uvalue_memory_resource* get_uvalue_resource() noexcept {
+        using detail::uvalue_resource_state;
+
+        if ( uvalue_memory_resource* resource{uvalue_resource_state::thread()} ) {
+            return resource;
+        }
+
+        return uvalue_resource_state::global().load(std::memory_order_acquire);
+    }
+
+    inline uvalue_memory_resource* set_uvalue_resource(uvalue_memory_resource* resource) noexcept {
+        using detail::uvalue_resource_state;
+        return uvalue_resource_state::global().exchange(resource, std::memory_order_acq_rel);
+    }
+
+    inline uvalue_memory_resource* set_thread_uvalue_resource(uvalue_memory_resource* resource) noexcept {
+        using detail::uvalue_resource_state;
+        return std::exchange(uvalue_resource_state::thread(), resource);
+    }
+}
@@ -0,0 +1,97 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "meta_base.hpp"
+#include "meta_types.hpp"
+#include "meta_uvalue.hpp"
+#include "meta_uvalue_ref.hpp"
+
+namespace meta_hpp
+{
+    class uvalue_array final {
+    public:
+        uvalue_array() = default;
+        ~uvalue_array() noexcept;
+
+        uvalue_array(uvalue_array&& other) noexcept;
+        uvalue_array& operator=(uvalue_array&& other) noexcept;
+
+        uvalue_array(const uvalue_array& other) = delete;
+        uvalue_array& operator=(const uvalue_array& other) = delete;
+
+        template < typename T >
+        explicit uvalue_array(std::in_place_type_t<T>);
+
+        template < typename T >
+        explicit uvalue_array(std::in_place_type_t<T>, uvalue_list&& list);
+
+        [[nodiscard]] bool is_empty() const noexcept;
+        [[nodiscard]] std::size_t get_size() const noexcept;
+        [[nodiscard]] std::size_t get_capacity() const noexcept;
+
+        void clear() noexcept;
+        void reserve(std::size_t capacity);
+        void swap(uvalue_array& other) noexcept;
+
+        [[nodiscard]] any_type get_type() const noexcept;
+
+        [[nodiscard]] void* get_data() noexcept;
+        [[nodiscard]] const void* get_data() const noexcept;
+        [[nodiscard]] const void* get_cdata() const noexcept;
+
+        [[nodiscard]] uvalue_ref operator[](std::size_t index) noexcept;
+        [[nodiscard]] uvalue_ref operator[](std::size_t index) const noexcept;
+
+        template < typename T, typename... Args >
+        T& emplace_back(Args&&... args);
+
+        void push_back(uvalue&& value);
+        void pop_back() noexcept;
+
+        template < typename T >
+        [[nodiscard]] std::span<T> as_span();
+        template < typename T >
+        [[nodiscard]] std::span<const T> as_span() const;
+
+        [[nodiscard]] uvalue_array copy() const;
+        [[nodiscard]] bool has_copy_op() const noexcept;
+
+        [[nodiscard]] uvalue_list to_list() const&;
+        [[nodiscard]] uvalue_list to_list() &&;
+
+        void sort();
+        [[nodiscard]] std::vector<std::size_t> sort_indices() const;
+
+        [[nodiscard]] bool less(const uvalue_array& other) const;
+        [[nodiscard]] bool has_less_op() const noexcept;
+
+        [[nodiscard]] bool equals(const uvalue_array& other) const;
+        [[nodiscard]] bool has_equals_op() const noexcept;
+
+        [[nodiscard]] std::size_t get_hash() const;
+        void get_hashes(std::span<std::size_t> hashes) const;
+        [[nodiscard]] bool has_hash_op() const noexcept;
+
+    private:
+        struct vtable_t;
+
+        void grow(std::size_t capacity);
+        [[nodiscard]] void* get_element(std::size_t index) const noexcept;
+
+    private:
+        const vtable_t* vtable_{};
+        uvalue_memory_resource* resource_{};
+        void* data_{};
+        std::size_t size_{};
+        std::size_t capacity_{};
+    };
+
+    inline void swap(uvalue_array& l, uvalue_array& r) noexcept {
+        l.swap(r);
+    }
+}
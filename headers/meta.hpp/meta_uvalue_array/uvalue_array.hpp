@@ -0,0 +1,558 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "../meta_base.hpp"
+#include "../meta_registry.hpp"
+#include "../meta_uvalue.hpp"
+#include "../meta_uvalue/uvalue.hpp"
+#include "../meta_uvalue/uvalue_resource.hpp"
+#include "../meta_uvalue_array.hpp"
+
+#include "../meta_detail/value_traits/copy_traits.hpp"
+#include "../meta_detail/value_traits/equals_traits.hpp"
+#include "../meta_detail/value_traits/less_traits.hpp"
+
+namespace meta_hpp::detail
+{
+    template < typename T >
+    concept has_std_hash //
+        = requires(const T& v) {
+              { std::hash<T>{}(v) } -> std::convertible_to<std::size_t>;
+          };
+}
+
+namespace meta_hpp
+{
+    // all elements of an array have the same type, so every operation
+    // is resolved once for the whole range instead of once for each element
+    struct uvalue_array::vtable_t final {
+        // NOLINTBEGIN(*-avoid-const-or-ref-data-members)
+        const any_type type;
+        const std::size_t size;
+        const std::size_t align;
+
+        void (*const relocate)(void* dst, void* src, std::size_t count) noexcept;
+        void (*const destroy)(void* data, std::size_t count) noexcept;
+        void (*const push)(void* dst, uvalue&& value);
+
+        void (*const copy)(void* dst, const void* src, std::size_t count);
+        void (*const copy_to_list)(const void* data, std::size_t count, uvalue_list& list);
+        void (*const move_to_list)(void* data, std::size_t count, uvalue_list& list);
+
+        void (*const sort)(void* data, std::size_t count);
+        void (*const sort_indices)(const void* data, std::size_t count, std::size_t* indices);
+
+        bool (*const less)(const void* l, std::size_t l_count, const void* r, std::size_t r_count);
+        bool (*const equals)(const void* l, const void* r, std::size_t count);
+
+        std::size_t (*const hash)(const void* data, std::size_t count);
+        void (*const hashes)(const void* data, std::size_t count, std::size_t* hashes);
+        // NOLINTEND(*-avoid-const-or-ref-data-members)
+
+        template < typename Tp >
+        // NOLINTNEXTLINE(*-cognitive-complexity)
+        static const vtable_t* get() {
+            static_assert(std::is_same_v<Tp, std::decay_t<Tp>>);
+            static_assert(std::is_nothrow_move_constructible_v<Tp>, "array elements must be nothrow movable");
+            static_assert(std::is_nothrow_destructible_v<Tp>, "array elements must be nothrow destructible");
+
+            static const vtable_t table{
+                .type = resolve_type<Tp>(),
+                .size = sizeof(Tp),
+                .align = alignof(Tp),
+
+                .relocate{[](void* dst, void* src, std::size_t count) noexcept {
+                    Tp* first = static_cast<Tp*>(src);
+                    std::uninitialized_move_n(first, count, static_cast<Tp*>(dst));
+                    std::destroy_n(first, count);
+                }},
+
+                .destroy{[](void* data, std::size_t count) noexcept {
+                    std::destroy_n(static_cast<Tp*>(data), count); //
+                }},
+
+                .push{[](void* dst, uvalue&& value) {
+                    std::construct_at(static_cast<Tp*>(dst), std::move(value).template as<Tp>());
+                }},
+
+                .copy{[]() {
+                    if constexpr ( detail::has_copy_traits<Tp> ) {
+                        return +[](void* dst, const void* src, std::size_t count) {
+                            std::uninitialized_copy_n(static_cast<const Tp*>(src), count, static_cast<Tp*>(dst));
+                        };
+                    } else {
+                        return nullptr;
+                    }
+                }()},
+
+                .copy_to_list{[]() {
+                    if constexpr ( detail::has_copy_traits<Tp> ) {
+                        return +[](const void* data, std::size_t count, uvalue_list& list) {
+                            for ( const Tp& v : std::span{static_cast<const Tp*>(data), count} ) {
+                                list.emplace_back(detail::copy_traits<Tp>{}(v));
+                            }
+                        };
+                    } else {
+                        return nullptr;
+                    }
+                }()},
+
+                .move_to_list{[](void* data, std::size_t count, uvalue_list& list) {
+                    for ( Tp& v : std::span{static_cast<Tp*>(data), count} ) {
+                        list.emplace_back(std::move(v));
+                    }
+                }},
+
+                .sort{[]() {
+                    if constexpr ( detail::has_less_traits<Tp> ) {
+                        return +[](void* data, std::size_t count) {
+                            Tp* first = static_cast<Tp*>(data);
+                            std::sort(first, first + count, detail::less_traits<Tp>{});
+                        };
+                    } else {
+                        return nullptr;
+                    }
+                }()},
+
+                .sort_indices{[]() {
+                    if constexpr ( detail::has_less_traits<Tp> ) {
+                        return +[](const void* data, std::size_t count, std::size_t* indices) {
+                            const Tp* first = static_cast<const Tp*>(data);
+                            std::iota(indices, indices + count, std::size_t{});
+                            std::stable_sort(indices, indices + count, [first](std::size_t l, std::size_t r) {
+                                return detail::less_traits<Tp>{}(first[l], first[r]);
+                            });
+                        };
+                    } else {
+                        return nullptr;
+                    }
+                }()},
+
+                .less{[]() {
+                    if constexpr ( detail::has_less_traits<Tp> ) {
+                        return +[](const void* l, std::size_t l_count, const void* r, std::size_t r_count) {
+                            const Tp* l_first = static_cast<const Tp*>(l);
+                            const Tp* r_first = static_cast<const Tp*>(r);
+                            return std::lexicographical_compare(
+                                l_first,
+                                l_first + l_count,
+                                r_first,
+                                r_first + r_count,
+                                detail::less_traits<Tp>{}
+                            );
+                        };
+                    } else {
+                        return nullptr;
+                    }
+                }()},
+
+                .equals{[]() {
+                    if constexpr ( detail::has_equals_traits<Tp> ) {
+                        return +[](const void* l, const void* r, std::size_t count) {
+                            const Tp* l_first = static_cast<const Tp*>(l);
+                            return std::equal(l_first, l_first + count, static_cast<const Tp*>(r), detail::equals_traits<Tp>{});
+                        };
+                    } else {
+                        return nullptr;
+                    }
+                }()},
+
+                .hash{[]() {
+                    if constexpr ( detail::has_std_hash<Tp> ) {
+                        return +[](const void* data, std::size_t count) -> std::size_t {
+                            detail::hash_composer hash{};
+                            for ( const Tp& v : std::span{static_cast<const Tp*>(data), count} ) {
+                                hash << static_cast<std::size_t>(std::hash<Tp>{}(v));
+                            }
+                            return hash;
+                        };
+                    } else {
+                        return nullptr;
+                    }
+                }()},
+
+                .hashes{[]() {
+                    if constexpr ( detail::has_std_hash<Tp> ) {
+                        return +[](const void* data, std::size_t count, std::size_t* hashes) {
+                            const Tp* first = static_cast<const Tp*>(data);
+                            std::transform(first, first + count, hashes, std::hash<Tp>{});
+                        };
+                    } else {
+                        return nullptr;
+                    }
+                }()},
+            };
+
+            return &table;
+        }
+    };
+}
+
+namespace meta_hpp
+{
+    inline uvalue_array::~uvalue_array() noexcept {
+        clear();
+
+        if ( data_ != nullptr ) {
+            detail::uvalue_deallocate(resource_, data_, capacity_ * vtable_->size, vtable_->align);
+        }
+    }
+
+    inline uvalue_array::uvalue_array(uvalue_array&& other) noexcept
+    : vtable_{std::exchange(other.vtable_, nullptr)}
+    , resource_{std::exchange(other.resource_, nullptr)}
+    , data_{std::exchange(other.data_, nullptr)}
+    , size_{std::exchange(other.size_, 0)}
+    , capacity_{std::exchange(other.capacity_, 0)} {}
+
+    inline uvalue_array& uvalue_array::operator=(uvalue_array&& other) noexcept {
+        if ( this != &other ) {
+            uvalue_array{std::move(other)}.swap(*this);
+        }
+        return *this;
+    }
+
+    template < typename T >
+    uvalue_array::uvalue_array(std::in_place_type_t<T>)
+    : vtable_{vtable_t::get<T>()} {}
+
+    template < typename T >
+    uvalue_array::uvalue_array(std::in_place_type_t<T>, uvalue_list&& list)
+    : uvalue_array{std::in_place_type<T>} {
+        const any_type type{resolve_type<T>()};
+
+        // types are checked before moving, so a failed conversion keeps the list
+        for ( const uvalue& v : list ) {
+            if ( v.get_type() != type ) {
+                throw_exception(error_code::bad_uvalue_access);
+            }
+        }
+
+        reserve(list.size());
+
+        for ( uvalue& v : list ) {
+            vtable_->push(get_element(size_), std::move(v));
+            ++size_;
+        }
+    }
+
+    inline bool uvalue_array::is_empty() const noexcept {
+        return size_ == 0;
+    }
+
+    inline std::size_t uvalue_array::get_size() const noexcept {
+        return size_;
+    }
+
+    inline std::size_t uvalue_array::get_capacity() const noexcept {
+        return capacity_;
+    }
+
+    inline void uvalue_array::clear() noexcept {
+        if ( size_ > 0 ) {
+            vtable_->destroy(data_, size_);
+            size_ = 0;
+        }
+    }
+
+    inline void uvalue_array::reserve(std::size_t capacity) {
+        // the size of elements is unknown until the array has a type
+        if ( vtable_ != nullptr && capacity > capacity_ ) {
+            grow(capacity);
+        }
+    }
+
+    inline void uvalue_array::swap(uvalue_array& other) noexcept {
+        std::swap(vtable_, other.vtable_);
+        std::swap(resource_, other.resource_);
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+    inline any_type uvalue_array::get_type() const noexcept {
+        return vtable_ != nullptr ? vtable_->type : any_type{};
+    }
+
+    inline void* uvalue_array::get_data() noexcept {
+        return data_;
+    }
+
+    inline const void* uvalue_array::get_data() const noexcept {
+        return data_;
+    }
+
+    inline const void* uvalue_array::get_cdata() const noexcept {
+        return data_;
+    }
+
+    inline uvalue_ref uvalue_array::operator[](std::size_t index) noexcept {
+        META_HPP_ASSERT(index < size_ && "an attempt to access an array element out of range");
+        return uvalue_ref{vtable_->type, get_element(index)};
+    }
+
+    inline uvalue_ref uvalue_array::operator[](std::size_t index) const noexcept {
+        META_HPP_ASSERT(index < size_ && "an attempt to access an array element out of range");
+        return uvalue_ref{vtable_->type, static_cast<const void*>(get_element(index))};
+    }
+
+    template < typename T, typename... Args >
+    T& uvalue_array::emplace_back(Args&&... args) {
+        static_assert(std::is_same_v<T, std::decay_t<T>>);
+
+        if ( vtable_ == nullptr ) {
+            META_HPP_DEV_ASSERT(size_ == 0 && capacity_ == 0);
+            vtable_ = vtable_t::get<T>();
+        } else if ( vtable_->type != resolve_type<T>() ) {
+            // vtables can be duplicated across shared libraries, types can't
+            throw_exception(error_code::bad_uvalue_access);
+        }
+
+        if ( size_ == capacity_ ) {
+            // arguments can refer to elements of this array
+            T value(std::forward<Args>(args)...);
+            grow(size_ + 1);
+            T* result = std::construct_at(static_cast<T*>(get_element(size_)), std::move(value));
+            ++size_;
+            return *result;
+        }
+
+        T* result = std::construct_at(static_cast<T*>(get_element(size_)), std::forward<Args>(args)...);
+        ++size_;
+        return *result;
+    }
+
+    inline void uvalue_array::push_back(uvalue&& value) {
+        if ( vtable_ == nullptr || value.get_type() != vtable_->type ) {
+            throw_exception(error_code::bad_uvalue_access);
+        }
+
+        if ( size_ == capacity_ ) {
+            grow(size_ + 1);
+        }
+
+        vtable_->push(get_element(size_), std::move(value));
+        ++size_;
+    }
+
+    inline void uvalue_array::pop_back() noexcept {
+        META_HPP_ASSERT(size_ > 0 && "an attempt to pop an element from an empty array");
+        vtable_->destroy(get_element(size_ - 1), 1);
+        --size_;
+    }
+
+    template < typename T >
+    std::span<T> uvalue_array::as_span() {
+        static_assert(std::is_same_v<T, std::decay_t<T>>);
+
+        if ( vtable_ == nullptr ) {
+            return {};
+        }
+
+        if ( vtable_->type != resolve_type<T>() ) {
+            throw_exception(error_code::bad_uvalue_access);
+        }
+
+        return std::span{static_cast<T*>(data_), size_};
+    }
+
+    template < typename T >
+    std::span<const T> uvalue_array::as_span() const {
+        static_assert(std::is_same_v<T, std::decay_t<T>>);
+
+        if ( vtable_ == nullptr ) {
+            return {};
+        }
+
+        if ( vtable_->type != resolve_type<T>() ) {
+            throw_exception(error_code::bad_uvalue_access);
+        }
+
+        return std::span{static_cast<const T*>(data_), size_};
+    }
+
+    inline uvalue_array uvalue_array::copy() const {
+        uvalue_array result;
+
+        if ( vtable_ == nullptr ) {
+            return result;
+        }
+
+        if ( vtable_->copy == nullptr ) {
+            throw_exception(error_code::bad_uvalue_operation);
+        }
+
+        result.vtable_ = vtable_;
+        result.reserve(size_);
+
+        vtable_->copy(result.data_, data_, size_);
+        result.size_ = size_;
+
+        return result;
+    }
+
+    inline bool uvalue_array::has_copy_op() const noexcept {
+        return vtable_ == nullptr || vtable_->copy != nullptr;
+    }
+
+    inline uvalue_list uvalue_array::to_list() const& {
+        uvalue_list result;
+
+        if ( vtable_ == nullptr ) {
+            return result;
+        }
+
+        if ( vtable_->copy_to_list == nullptr ) {
+            throw_exception(error_code::bad_uvalue_operation);
+        }
+
+        result.reserve(size_);
+        vtable_->copy_to_list(data_, size_, result);
+        return result;
+    }
+
+    inline uvalue_list uvalue_array::to_list() && {
+        uvalue_list result;
+
+        if ( vtable_ == nullptr ) {
+            return result;
+        }
+
+        result.reserve(size_);
+        vtable_->move_to_list(data_, size_, result);
+        clear();
+        return result;
+    }
+
+    inline void uvalue_array::sort() {
+        if ( vtable_ == nullptr ) {
+            return;
+        }
+
+        if ( vtable_->sort == nullptr ) {
+            throw_exception(error_code::bad_uvalue_operation);
+        }
+
+        vtable_->sort(data_, size_);
+    }
+
+    inline std::vector<std::size_t> uvalue_array::sort_indices() const {
+        if ( vtable_ == nullptr ) {
+            return {};
+        }
+
+        if ( vtable_->sort_indices == nullptr ) {
+            throw_exception(error_code::bad_uvalue_operation);
+        }
+
+        std::vector<std::size_t> indices(size_);
+        vtable_->sort_indices(data_, size_, indices.data());
+        return indices;
+    }
+
+    inline bool uvalue_array::less(const uvalue_array& other) const {
+        if ( this == &other ) {
+            return false;
+        }
+
+        const any_type l_type{get_type()};
+        const any_type r_type{other.get_type()};
+
+        if ( l_type != r_type || vtable_ == nullptr ) {
+            return l_type < r_type;
+        }
+
+        if ( vtable_->less != nullptr ) {
+            return vtable_->less(data_, size_, other.data_, other.size_);
+        }
+
+        throw_exception(error_code::bad_uvalue_operation);
+    }
+
+    inline bool uvalue_array::has_less_op() const noexcept {
+        return vtable_ == nullptr || vtable_->less != nullptr;
+    }
+
+    inline bool uvalue_array::equals(const uvalue_array& other) const {
+        if ( this == &other ) {
+            return true;
+        }
+
+        const any_type l_type{get_type()};
+        const any_type r_type{other.get_type()};
+
+        if ( l_type != r_type || vtable_ == nullptr ) {
+            return l_type == r_type;
+        }
+
+        if ( vtable_->equals != nullptr ) {
+            return size_ == other.size_ && vtable_->equals(data_, other.data_, size_);
+        }
+
+        throw_exception(error_code::bad_uvalue_operation);
+    }
+
+    inline bool uvalue_array::has_equals_op() const noexcept {
+        return vtable_ == nullptr || vtable_->equals != nullptr;
+    }
+
+    inline std::size_t uvalue_array::get_hash() const {
+        if ( vtable_ == nullptr ) {
+            return detail::hash_composer{};
+        }
+
+        if ( vtable_->hash == nullptr ) {
+            throw_exception(error_code::bad_uvalue_operation);
+        }
+
+        return vtable_->hash(data_, size_);
+    }
+
+    inline void uvalue_array::get_hashes(std::span<std::size_t> hashes) const {
+        META_HPP_ASSERT(hashes.size() == size_ && "the span of hashes must have the size of the array");
+
+        if ( vtable_ == nullptr ) {
+            return;
+        }
+
+        if ( vtable_->hashes == nullptr ) {
+            throw_exception(error_code::bad_uvalue_operation);
+        }
+
+        vtable_->hashes(data_, std::min(hashes.size(), size_), hashes.data());
+    }
+
+    inline bool uvalue_array::has_hash_op() const noexcept {
+        return vtable_ == nullptr || vtable_->hash != nullptr;
+    }
+
+    inline void uvalue_array::grow(std::size_t capacity) {
+        META_HPP_DEV_ASSERT(vtable_ != nullptr && capacity > capacity_);
+
+        constexpr std::size_t min_capacity{4};
+        capacity = std::max({capacity, capacity_ * 2, min_capacity});
+
+        // the buffer is returned to the resource it was allocated by
+        uvalue_memory_resource* resource{get_uvalue_resource()};
+        void* data{detail::uvalue_allocate(resource, capacity * vtable_->size, vtable_->align)};
+
+        if ( data_ != nullptr ) {
+            vtable_->relocate(data, data_, size_);
+            detail::uvalue_deallocate(resource_, data_, capacity_ * vtable_->size, vtable_->align);
+        }
+
+        resource_ = resource;
+        data_ = data;
+        capacity_ = capacity;
+    }
+
+    inline void* uvalue_array::get_element(std::size_t index) const noexcept {
+        META_HPP_DEV_ASSERT(vtable_ != nullptr && index <= capacity_);
+        return static_cast<std::byte*>(data_) + index * vtable_->size; // NOLINT(*-pointer-arithmetic)
+    }
+}
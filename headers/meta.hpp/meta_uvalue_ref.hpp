@@ -0,0 +1,66 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "meta_base.hpp"
+#include "meta_types.hpp"
+#include "meta_uvalue.hpp"
+
+namespace meta_hpp
+{
+    class uvalue_ref final {
+    public:
+        enum class ref_types : std::uint8_t {
+            lvalue,
+            const_lvalue,
+            rvalue,
+            const_rvalue,
+        };
+
+    public:
+        uvalue_ref() = default;
+
+        template < typename T, typename Tp = std::decay_t<T> >
+            requires(!uvalue_family<Tp>)
+        explicit uvalue_ref(T& val) noexcept;
+
+        template < typename T, typename Tp = std::decay_t<T> >
+            requires(!uvalue_family<Tp>)
+        explicit uvalue_ref(const T&& val) = delete;
+
+        template < typename T >
+            requires std::is_same_v<std::remove_cv_t<T>, uvalue>
+        explicit uvalue_ref(T& v) noexcept;
+
+        template < typename T >
+            requires std::is_same_v<std::remove_cv_t<T>, uvalue>
+        explicit uvalue_ref(const T&& v) = delete;
+
+        explicit uvalue_ref(any_type type, void* data, ref_types ref_type = ref_types::lvalue) noexcept;
+        explicit uvalue_ref(any_type type, const void* data, ref_types ref_type = ref_types::const_lvalue) noexcept;
+
+        [[nodiscard]] bool has_value() const noexcept;
+        [[nodiscard]] explicit operator bool() const noexcept;
+
+        [[nodiscard]] bool is_ref_const() const noexcept;
+        [[nodiscard]] ref_types get_ref_type() const noexcept;
+
+        [[nodiscard]] any_type get_type() const noexcept;
+
+        [[nodiscard]] void* get_data() const noexcept;
+        [[nodiscard]] const void* get_cdata() const noexcept;
+
+    private:
+        template < typename T >
+        [[nodiscard]] static constexpr ref_types get_ref_type_of() noexcept;
+
+    private:
+        any_type type_{};
+        void* data_{};
+        ref_types ref_type_{};
+    };
+}
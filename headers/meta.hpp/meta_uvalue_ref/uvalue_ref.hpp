@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/meta.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2021-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "../meta_base.hpp"
+#include "../meta_registry.hpp"
+#include "../meta_uvalue_ref.hpp"
+
+namespace meta_hpp
+{
+    template < typename T, typename Tp >
+        requires(!uvalue_family<Tp>)
+    uvalue_ref::uvalue_ref(T& val) noexcept
+    : type_{resolve_type<std::remove_cv_t<T>>()}
+    , data_{const_cast<std::remove_cv_t<T>*>(std::addressof(val))} // NOLINT(*-const-cast)
+    , ref_type_{get_ref_type_of<T&>()} {}
+
+    template < typename T >
+        requires std::is_same_v<std::remove_cv_t<T>, uvalue>
+    uvalue_ref::uvalue_ref(T& v) noexcept
+    : type_{v.get_type()}
+    , data_{const_cast<void*>(v.get_cdata())} // NOLINT(*-const-cast)
+    , ref_type_{get_ref_type_of<T&>()} {
+        // shared values are immutable, so they are referenced as constant ones
+        if ( v.is_shared() ) {
+            ref_type_ = ref_types::const_lvalue;
+        }
+    }
+
+    inline uvalue_ref::uvalue_ref(any_type type, void* data, ref_types ref_type) noexcept
+    : type_{data != nullptr ? type : any_type{}}
+    , data_{data}
+    , ref_type_{ref_type} {}
+
+    inline uvalue_ref::uvalue_ref(any_type type, const void* data, ref_types ref_type) noexcept
+    : type_{data != nullptr ? type : any_type{}}
+    , data_{const_cast<void*>(data)} // NOLINT(*-const-cast)
+    , ref_type_{ref_type} {
+        META_HPP_ASSERT(                                                                  //
+            (ref_type == ref_types::const_lvalue || ref_type == ref_types::const_rvalue) //
+            && "an attempt to make a mutable reference to a constant value"
+        );
+    }
+
+    template < typename T >
+    constexpr uvalue_ref::ref_types uvalue_ref::get_ref_type_of() noexcept {
+        if constexpr ( std::is_lvalue_reference_v<T> ) {
+            return std::is_const_v<std::remove_reference_t<T>> ? ref_types::const_lvalue : ref_types::lvalue;
+        } else {
+            return std::is_const_v<std::remove_reference_t<T>> ? ref_types::const_rvalue : ref_types::rvalue;
+        }
+    }
+
+    inline bool uvalue_ref::has_value() const noexcept {
+        return data_ != nullptr;
+    }
+
+    inline uvalue_ref::operator bool() const noexcept {
+        return has_value();
+    }
+
+    inline bool uvalue_ref::is_ref_const() const noexcept {
+        return ref_type_ == ref_types::const_lvalue //
+            || ref_type_ == ref_types::const_rvalue;
+    }
+
+    inline uvalue_ref::ref_types uvalue_ref::get_ref_type() const noexcept {
+        return ref_type_;
+    }
+
+    inline any_type uvalue_ref::get_type() const noexcept {
+        return type_;
+    }
+
+    inline void* uvalue_ref::get_data() const noexcept {
+        return is_ref_const() ? nullptr : data_;
+    }
+
+    inline const void* uvalue_ref::get_cdata() const noexcept {
+        return data_;
+    }
+}